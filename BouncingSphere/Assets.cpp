@@ -0,0 +1,267 @@
+#include "Assets.h"
+#include <algorithm>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#if defined(_WIN32)
+#include <direct.h>
+#define makeDirectory(path) _mkdir(path)
+#else
+#include <sys/stat.h>
+#define makeDirectory(path) mkdir(path, 0755)
+#endif
+
+enum AssetType { ASSET_IMAGE, ASSET_TEXTURE, ASSET_SOUND };
+enum AssetState { ASSET_QUEUED, ASSET_READY, ASSET_FAILED, ASSET_UNLOADED }; // Written by main thread only
+
+struct Asset {
+	AssetType type;
+	AssetState state;
+	std::string fileName;
+	Image image; // Decoded data (worker thread)
+	Wave wave;
+	Texture2D texture; // Uploaded data (main thread)
+	Sound sound;
+};
+
+// Assets are added & removed by main thread only, deque keeps their addresses for workers while new ones are added
+// Decode queue is consumed by workers, upload queue by main thread, both under assetsMutex
+static std::deque<Asset> assets;
+static std::deque<Asset*> decodeQueue;
+static std::deque<Asset*> uploadQueue;
+static std::vector<std::thread> workers;
+static std::mutex assetsMutex;
+static std::condition_variable assetsWake;
+static bool workersQuit = false;
+static AssetPack pack = { 0 }; // Read only once loading started
+static std::string packDirectory;
+
+bool UseAssetPack(const char* fileName, const char* directory) {
+	UnloadAssetPack(pack);
+	pack = FileExists(fileName) ? LoadAssetPack(fileName) : AssetPack{ 0 };
+	packDirectory = std::string(directory) + "/";
+	return pack.data != NULL;
+}
+
+// Packed file data (read in place), NULL if not packed
+static const unsigned char* packedFileData(const std::string& fileName, unsigned int* size) {
+	if (pack.data == NULL || fileName.compare(0, packDirectory.size(), packDirectory) != 0)
+		return NULL;
+	return GetAssetPackFileData(pack, fileName.c_str() + packDirectory.size(), size);
+}
+
+// Sounds cache file: device format samples only, content addressed (FNV-1a hash of source file data)
+// NOTE: TextFormat() is not used, its static buffers are not thread safe
+static std::string soundCachePath(const unsigned char* data, unsigned int size) {
+	unsigned long long hash = 14695981039346656037ULL;
+	for (unsigned int i = 0; i < size; i++)
+		hash = (hash ^ data[i]) * 1099511628211ULL;
+
+	char path[64];
+	snprintf(path, sizeof(path), "%s/%016llx-%i-%i-%i.pcm", ASSET_SOUND_CACHE_DIRECTORY, hash, ASSET_SOUND_SAMPLE_RATE, ASSET_SOUND_SAMPLE_SIZE, ASSET_SOUND_CHANNELS);
+	return path;
+}
+
+// Saved into a temporary file renamed once complete: a partially written cache file is never read
+static void saveSoundCache(const std::string& path, Wave wave) {
+	char temporary[80];
+	snprintf(temporary, sizeof(temporary), "%s.%p.tmp", path.c_str(), wave.data); // Unique if same sound decoded twice at once
+	makeDirectory(ASSET_SOUND_CACHE_DIRECTORY);
+	if (!SaveFileData(temporary, wave.data, wave.sampleCount * wave.sampleSize / 8) || std::rename(temporary, path.c_str()) != 0)
+		std::remove(temporary);
+}
+
+// Sound wave in device format: read from cache if available, otherwise decoded, resampled & cached
+// LoadSoundFromWave() then only copies samples into audio buffer
+static Wave loadSoundWave(const std::string& fileName, const unsigned char* data, unsigned int size) {
+	unsigned char* loaded = NULL;
+	if (data == NULL)
+		data = loaded = LoadFileData(fileName.c_str(), &size);
+	if (data == NULL)
+		return Wave{ 0 };
+
+	std::string cachePath = soundCachePath(data, size);
+	const unsigned int sampleBytes = ASSET_SOUND_SAMPLE_SIZE / 8;
+	unsigned int cachedSize = 0;
+	unsigned char* cached = FileExists(cachePath.c_str()) ? LoadFileData(cachePath.c_str(), &cachedSize) : NULL;
+
+	Wave wave = { 0 };
+	if (cached != NULL && cachedSize > 0 && cachedSize % (sampleBytes * ASSET_SOUND_CHANNELS) == 0)
+		wave = { cachedSize / sampleBytes, ASSET_SOUND_SAMPLE_RATE, ASSET_SOUND_SAMPLE_SIZE, ASSET_SOUND_CHANNELS, cached };
+	else {
+		UnloadFileData(cached);
+		wave = LoadWaveFromMemory(GetFileExtension(fileName.c_str()), data, size);
+		if (wave.data != NULL) {
+			WaveFormat(&wave, ASSET_SOUND_SAMPLE_RATE, ASSET_SOUND_SAMPLE_SIZE, ASSET_SOUND_CHANNELS);
+			saveSoundCache(cachePath, wave);
+		}
+	}
+
+	UnloadFileData(loaded);
+	return wave;
+}
+
+static void decodeAsset(Asset& asset) {
+	unsigned int size = 0;
+	const unsigned char* data = packedFileData(asset.fileName, &size);
+
+	if (asset.type == ASSET_SOUND)
+		asset.wave = loadSoundWave(asset.fileName, data, size);
+	else
+		asset.image = data != NULL ? LoadImageFromMemory(GetFileExtension(asset.fileName.c_str()), data, size) : LoadImage(asset.fileName.c_str());
+}
+
+static void assetsWorker() {
+	std::unique_lock<std::mutex> lock(assetsMutex);
+	while (true) {
+		assetsWake.wait(lock, [] { return workersQuit || !decodeQueue.empty(); });
+		if (workersQuit)
+			return;
+		Asset* asset = decodeQueue.front();
+		decodeQueue.pop_front();
+
+		lock.unlock();
+		decodeAsset(*asset);
+		lock.lock();
+
+		uploadQueue.push_back(asset);
+	}
+}
+
+static AssetHandle loadAsync(AssetType type, const char* fileName) {
+	std::lock_guard<std::mutex> lock(assetsMutex);
+	if (workers.empty()) {
+		workersQuit = false;
+		int count = std::max(1, std::min((int) std::thread::hardware_concurrency() - 1, ASSET_THREADS_MAX)); // Main thread keeps its core
+		for (int i = 0; i < count; i++)
+			workers.emplace_back(assetsWorker);
+	}
+
+	assets.push_back({ type, ASSET_QUEUED, fileName, { 0 }, { 0 }, { 0 }, { 0 } });
+	decodeQueue.push_back(&assets.back());
+	assetsWake.notify_one();
+	return (AssetHandle) assets.size() - 1;
+}
+
+AssetHandle LoadImageAsync(const char* fileName) {
+	return loadAsync(ASSET_IMAGE, fileName);
+}
+
+AssetHandle LoadTextureAsync(const char* fileName) {
+	return loadAsync(ASSET_TEXTURE, fileName);
+}
+
+AssetHandle LoadSoundAsync(const char* fileName) {
+	return loadAsync(ASSET_SOUND, fileName);
+}
+
+// Upload of decoded data (main thread only)
+static void uploadAsset(Asset& asset) {
+	switch (asset.type) {
+		case ASSET_IMAGE:
+			asset.state = asset.image.data != NULL ? ASSET_READY : ASSET_FAILED;
+			break;
+		case ASSET_TEXTURE:
+			if (asset.image.data != NULL)
+				asset.texture = LoadTextureFromImage(asset.image);
+			UnloadImage(asset.image);
+			asset.image = { 0 };
+			asset.state = asset.texture.id != 0 ? ASSET_READY : ASSET_FAILED;
+			break;
+		case ASSET_SOUND:
+			asset.sound = LoadSoundFromWave(asset.wave);
+			UnloadWave(asset.wave);
+			asset.wave = { 0 };
+			asset.state = asset.sound.stream.buffer != NULL ? ASSET_READY : ASSET_FAILED;
+			break;
+	}
+}
+
+void UpdateAssets(float budget) {
+	double start = GetTime();
+	do {
+		Asset* asset;
+		{
+			std::lock_guard<std::mutex> lock(assetsMutex);
+			if (uploadQueue.empty())
+				return;
+			asset = uploadQueue.front();
+			uploadQueue.pop_front();
+		}
+		uploadAsset(*asset);
+	} while (GetTime() - start < budget);
+}
+
+static Asset* readyAsset(AssetHandle handle) {
+	if (handle < 0 || handle >= (int) assets.size() || assets[handle].state != ASSET_READY)
+		return nullptr;
+	return &assets[handle];
+}
+
+bool IsAssetReady(AssetHandle handle) {
+	return readyAsset(handle) != nullptr;
+}
+
+int GetAssetsPending() {
+	return (int) std::count_if(assets.begin(), assets.end(), [](const Asset& asset) { return asset.state == ASSET_QUEUED; });
+}
+
+Image GetAssetImage(AssetHandle handle) {
+	Asset* asset = readyAsset(handle);
+	return asset != nullptr ? asset->image : Image{ 0 };
+}
+
+Texture2D GetAssetTexture(AssetHandle handle) {
+	Asset* asset = readyAsset(handle);
+	return asset != nullptr ? asset->texture : Texture2D{ 0 };
+}
+
+Sound GetAssetSound(AssetHandle handle) {
+	Asset* asset = readyAsset(handle);
+	return asset != nullptr ? asset->sound : Sound{ 0 };
+}
+
+static void unloadAsset(Asset& asset) {
+	if (asset.state == ASSET_READY) {
+		switch (asset.type) {
+			case ASSET_IMAGE: UnloadImage(asset.image); break;
+			case ASSET_TEXTURE: UnloadTexture(asset.texture); break;
+			case ASSET_SOUND: UnloadSound(asset.sound); break;
+		}
+	}
+	asset.state = ASSET_UNLOADED;
+}
+
+void UnloadAsset(AssetHandle handle) {
+	Asset* asset = readyAsset(handle);
+	if (asset != nullptr)
+		unloadAsset(*asset);
+}
+
+void UnloadAssets() {
+	{
+		std::lock_guard<std::mutex> lock(assetsMutex);
+		workersQuit = true;
+	}
+	assetsWake.notify_all();
+	for (auto& worker : workers)
+		worker.join();
+	workers.clear();
+
+	for (Asset* asset : uploadQueue) { // Decoded, not uploaded
+		UnloadImage(asset->image);
+		UnloadWave(asset->wave);
+	}
+	decodeQueue.clear();
+	uploadQueue.clear();
+	for (auto& asset : assets)
+		unloadAsset(asset);
+	assets.clear();
+
+	UnloadAssetPack(pack);
+	pack = { 0 };
+}
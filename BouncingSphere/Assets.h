@@ -0,0 +1,34 @@
+#ifndef __ASSETS_H__
+#define __ASSETS_H__
+#include "raylib.h"
+
+// Asynchronous assets loading: files are read and decoded by worker threads, then uploads that need the main thread
+// (GPU textures, audio device buffers) are drained by UpdateAssets() under a per-frame time budget
+// Files can be read from a memory mapped asset pack (ExportAssetPack()): decoded in place, without file copy in RAM
+
+#define ASSET_THREADS_MAX 4
+#define ASSET_PACK_FILE "resources.pack" // Built from ASSET_PACK_DIRECTORY with --pack
+#define ASSET_PACK_DIRECTORY "resources"
+#define ASSET_UPLOAD_BUDGET 0.002f // Seconds of uploads per frame
+#define ASSET_SOUND_SAMPLE_RATE 44100 // Audio device format (raylib AUDIO_DEVICE_*): sounds are resampled by workers
+#define ASSET_SOUND_SAMPLE_SIZE 32
+#define ASSET_SOUND_CHANNELS 2
+#define ASSET_SOUND_CACHE_DIRECTORY "cache" // Converted sounds samples, named by source data hash & device format (can be deleted)
+
+typedef int AssetHandle; // -1 if not loaded
+
+bool UseAssetPack(const char* fileName, const char* directory); // Before any load: files under directory are read from pack (if it exists)
+AssetHandle LoadImageAsync(const char* fileName);   // Kept in RAM (e.g. window icon)
+AssetHandle LoadTextureAsync(const char* fileName); // Decoded by workers, uploaded to GPU
+AssetHandle LoadSoundAsync(const char* fileName);   // Decoded & resampled by workers (or read from cache), loaded into audio device (initialized)
+
+void UpdateAssets(float budget); // Once per frame: uploads decoded assets during about budget seconds (one at least)
+bool IsAssetReady(AssetHandle handle);
+int GetAssetsPending(); // Assets not ready yet
+Image GetAssetImage(AssetHandle handle);     // Empty if not ready
+Texture2D GetAssetTexture(AssetHandle handle);
+Sound GetAssetSound(AssetHandle handle);
+void UnloadAsset(AssetHandle handle); // Ready assets only
+void UnloadAssets(); // Stops workers (queued files are not loaded), unloads every asset and asset pack
+
+#endif
@@ -1,8 +1,21 @@
 #include "raylib.h"
 #include "raymath.h"
+#include "Assets.h"
 #include "Models.h"
+#include "Profiler.h"
+#include "Resolution.h"
 #include "Utils.h"
+#include "external/stb_image_resize.h" // Reference resize (raylib implementation)
+extern "C" {
+#include "external/stb_perlin.h" // Reference perlin noise (raylib implementation)
+}
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <functional>
 #include <string>
+#include <thread>
 #include <vector>
 
 #if defined(PLATFORM_DESKTOP)
@@ -17,6 +30,39 @@
 #define GAME_TITLE_SCREEN 0b01
 #define GAME_RUNNING 0b10
 #define GAME_PAUSED 0b11
+#define SOUND_VOICES_PER_FRAME 4 // Collision sounds started per frame: simultaneous impacts are coalesced
+#define SOUND_IMPACT_MIN 0.5f // Weaker impacts (motion change) are silent, e.g. ball resting on an obstacle
+#define SOUND_IMPACT_MAX 15.0f // Impact played at full volume
+#define SOUND_PRIORITY_COLLISION 0
+#define SOUND_PRIORITY_EASTER_EGG 1
+#define BENCH_FRAMES 300
+#define BENCH_WARMUP_FRAMES 30
+#define BENCH_LOAD_ITERATIONS 20
+#define BENCH_PACK_FILE "bench.pack"
+#define BENCH_COMPRESSION_IMAGE "resources/images/icon.png"
+#define BENCH_FONT_GLYPHS 10000
+#define BENCH_FONT_TEXT_LENGTH 2000
+#define BENCH_AUDIO_SECONDS 2.0f
+#define BENCH_AUDIO_VOICES_MAX 128
+#define BENCH_AUDIO_RENDER_SECONDS 10 // Audio rendered offline per voice count
+#define AUDIO_STRESS_SECONDS 10.0f
+#define AUDIO_STRESS_SOUNDS 16
+#define AUDIO_SAMPLE_RATE 44100 // Audio device format (raylib AUDIO_DEVICE_*)
+#define AUDIO_CHANNELS 2
+#define AUDIO_CHECK_SECONDS 4
+#define AUDIO_CHECK_BALLS 20
+#define AUDIO_CHECK_TOLERANCE 2 // 16 bit samples difference allowed (SIMD or scalar mixing rounding)
+#define MUSIC_CHECK_FILE "resources/sounds/easter_egg.mp3"
+#define MUSIC_CHECK_SECONDS 8 // Music played twice (looping) then once more after restart
+#define MUSIC_CHECK_RESTART_FRAME 90 // Music stopped and played again (decoder restart)
+#define MUSIC_CHECK_LATENCY 0.1f
+#define MUSIC_CHECK_TOLERANCE 1e-4f
+#define FORMAT_CHECK_SIZES 7
+#define RESIZE_CHECK_SIZES 5
+#define RESIZE_CHECK_THREADS 3 // Odd threads count: strips of different heights
+#define DRAW_CHECK_TINTS 5
+#define NOISE_CHECK_THREADS 3
+#define MIX_CHECK_TOLERANCE 1e-6f // Scalar code may be contracted into fused multiply-adds by compiler
 
 struct Obstacle {
 	Referential ref;
@@ -45,7 +91,7 @@ Obstacle NewObstacle(Vector3 pos) {
 }
 
 typedef std::vector<Obstacle> Obstacles;
-typedef std::vector<BoxRounded> Boxes;
+typedef FrameArray<BoxRounded> Boxes; // Obstacles grown by a ball radius, allocated in frame arena
 
 struct Ball {
 	float r;
@@ -60,6 +106,11 @@ struct Ball {
 	void draw() {
 		Sphere{ this->pos, this->r }.draw(this->rotation, this->color);
 	}
+
+	// Queued, drawn by MyDrawSphereImpostors()
+	void drawImpostor() {
+		MyDrawSphereImpostor(this->rotation, this->pos, this->r, this->color);
+	}
 };
 
 Ball NewBall(Vector3 pos, Color color) {
@@ -75,6 +126,8 @@ Ball NewBall(Vector3 pos, Color color) {
 	};
 }
 
+typedef std::vector<Ball> Balls;
+
 void Bounce(Ball* ball, Vector3 point, Vector3 normal, float dt) {
 	Vector3 old = ball->motion;
 	ball->motion = ball->motion / normal;
@@ -121,10 +174,11 @@ bool DynamicCollide(Vector3 a, Vector3 b, Boxes boxes, Ball* ball, float dt, siz
 	return false;
 }
 
-bool MoveBall(Ball* ball, Obstacles obstacles, float dt) {
+bool MoveBall(Ball* ball, Obstacles &obstacles, float dt) {
 	Vector3 b = ball->pos + ball->motion * dt;
 	size_t count = obstacles.size();
-	Boxes boxes(count);
+	FrameArenaScope scope;
+	Boxes boxes = FrameAllocArray<BoxRounded>(count);
 	for (size_t i = 0; i < count; i++)
 		boxes[i] = obstacles[i].withRadius(ball->r);
 	return StaticCollide(boxes, ball, dt) || DynamicCollide(ball->pos, b, boxes, ball, dt);
@@ -175,13 +229,23 @@ void MyUpdateOrbitalCamera(Camera* camera, float deltaTime) {
 	camera->target = centerPos;
 }
 
-void SetupGameObjects(Ball &ball, Obstacles &obstaclesOut) {
-	ball = NewBall({ 0, 0, 0 }, BLUE);
+void SetupGameObjects(Balls &ballsOut, Obstacles &obstaclesOut, int nBalls = 1, int nObstaclesSide = 3) {
+	Balls balls(0);
+	balls.push_back(NewBall({ 0, 0, 0 }, BLUE));
 	Obstacles obstacles(0);
 
-	for (int x = -5; x <= 5; x += 5)
-		for (int z = -5; z <= 5; z += 5)
-			obstacles.push_back(NewObstacle({ (float) x, -5, (float) z }));
+	// Obstacles evenly spread on a grid (default: 3x3 grid from -5 to 5)
+	for (int i = 0; i < nObstaclesSide; i++)
+		for (int j = 0; j < nObstaclesSide; j++) {
+			float x = nObstaclesSide > 1 ? -5 + 10.0f * i / (nObstaclesSide - 1) : 0;
+			float z = nObstaclesSide > 1 ? -5 + 10.0f * j / (nObstaclesSide - 1) : 0;
+			obstacles.push_back(NewObstacle({ x, -5, z }));
+		}
+
+	// Extra balls (stress scenes) randomly placed in the upper half of the box
+	Color colors[] = { BLUE, RED, GREEN, PURPLE, GOLD, SKYBLUE };
+	for (int n = 1; n < nBalls; n++)
+		balls.push_back(NewBall({ randPos() * 8, 2 + random() * 6, randPos() * 8 }, colors[n % 6]));
 
 	// Environment walls
 	Color transparentPink = { 255, 109, 194, 90 };
@@ -192,10 +256,1110 @@ void SetupGameObjects(Ball &ball, Obstacles &obstaclesOut) {
 	obstacles.push_back({ localReferential({ 0, 0, -10.5 }, QuaternionIdentity()), { 10, 10, 0.5 }, 0, transparentPink });
 	obstacles.push_back({ localReferential({ 0, 0, 10.5 }, QuaternionIdentity()), { 10, 10, 0.5 }, 0, transparentPink });
 
+	ballsOut = balls;
 	obstaclesOut = obstacles;
 }
 
+// Returns the number of balls which collided during this step, their impact (motion change) is appended to impacts if given
+int StepPhysics(Balls &balls, Obstacles &obstacles, float dt, std::vector<float>* impacts = nullptr) {
+	int collisions = 0;
+	for (auto &ball : balls) {
+		// Gravity & rotation
+		ball.motion.y -= GRAVITY * dt;
+		ball.rotation = ball.rotation * ball.rotationQuaternion;
+
+		// Collision
+		Vector3 motion = ball.motion;
+		if (MoveBall(&ball, obstacles, dt)) {
+			collisions++;
+			if (impacts)
+				impacts->push_back(Vector3Length(ball.motion - motion));
+		}
+	}
+	ResetFrameArenas(); // Collision buffers released
+	return collisions;
+}
+
+// Simultaneous collisions are coalesced into a bounded number of sounds: one per strongest impact, weaker impacts add
+// their energy to the weakest of these sounds (closest strength), whose volume is scaled by the resulting impact strength
+void PlayCollisionSounds(std::vector<float> &impacts, AssetHandle sounds[4]) {
+	impacts.erase(std::remove_if(impacts.begin(), impacts.end(), [](float impact) { return impact < SOUND_IMPACT_MIN; }), impacts.end());
+	size_t voices = std::min(impacts.size(), (size_t) SOUND_VOICES_PER_FRAME);
+	std::partial_sort(impacts.begin(), impacts.begin() + voices, impacts.end(), std::greater<float>());
+	float energy[SOUND_VOICES_PER_FRAME] = { 0 };
+	for (size_t i = 0; i < impacts.size(); i++)
+		energy[std::min(i, voices - 1)] += impacts[i] * impacts[i];
+	for (size_t v = 0; v < voices; v++) {
+		AssetHandle sound = sounds[randomBits() % 4];
+		if (IsAssetReady(sound))
+			PlaySoundMultiEx(GetAssetSound(sound), min(sqrtf(energy[v]) / SOUND_IMPACT_MAX, 1), 1, SOUND_PRIORITY_COLLISION);
+	}
+}
+
+// Scene recorded in parallel into command buffers (reused from frame to frame): contiguous ranges of balls (unless
+// impostors) then obstacles
+std::vector<DrawCommandBuffer>& RecordScene(Balls &balls, Obstacles &obstacles, bool impostors) {
+	// Several chunks per thread for load balancing (obstacles costs are uneven)
+	static std::vector<DrawCommandBuffer> buffers;
+	int chunksMax = 4 * GetDrawThreadCount();
+	int nBalls = impostors ? 0 : (int) balls.size();
+	int nObstacles = (int) obstacles.size();
+	int ballChunks = std::min(nBalls, chunksMax);
+	int obstacleChunks = std::min(nObstacles, chunksMax);
+	buffers.resize(ballChunks + obstacleChunks);
+
+	auto record = [&](int chunk) {
+		if (chunk < ballChunks) {
+			for (int i = chunk * nBalls / ballChunks; i < (chunk + 1) * nBalls / ballChunks; i++)
+				balls[i].draw();
+		} else {
+			chunk -= ballChunks;
+			for (int i = chunk * nObstacles / obstacleChunks; i < (chunk + 1) * nObstacles / obstacleChunks; i++)
+				obstacles[i].draw();
+		}
+	};
+	RecordDrawCommands(buffers, std::ref(record)); // Wrapped: no std::function heap allocation for the lambda captures
+	return buffers;
+}
+
+// Multi-threaded: recorded scene submitted in recording order, so the batch receives exactly the same vertices as with
+// single-threaded drawing
+void DrawScene(Balls &balls, Obstacles &obstacles, bool impostors, bool threaded, Vector3 viewPos) {
+	if (impostors) {
+		for (auto &ball : balls)
+			ball.drawImpostor();
+		MyDrawSphereImpostors(viewPos); // Before obstacles: transparent walls are drawn over balls
+	}
+
+	if (!threaded) {
+		if (!impostors)
+			for (auto &ball : balls)
+				ball.draw();
+		for (auto &obstacle : obstacles)
+			obstacle.draw();
+		return;
+	}
+
+	for (auto &buffer : RecordScene(balls, obstacles, impostors))
+		SubmitDrawCommands(buffer);
+}
+
+// Default font text laid out once, with DrawText() size & spacing rules: only its position may change (window resize)
+TextLayout LoadText(const char* text, int fontSize) {
+	fontSize = std::max(fontSize, 10);
+	return LoadTextLayout(GetFontDefault(), text, (float) fontSize, (float) (fontSize / 10));
+}
+
+// Text benchmark: long multi-line string drawn several times per frame, DrawText() vs cached layout
+// Times text submission only (CPU side) and whole frame
+void RunTextBenchmark(int frames) {
+	const int lines = 40;
+	const int draws = 10;
+	std::string text;
+	for (int i = 0; i < lines; i++)
+		text += "The quick brown fox jumps over the lazy dog 0123456789 - Bouncing Sphere text benchmark\n";
+
+	TextLayout layout = LoadText(text.c_str(), 20);
+	for (int cached = 0; cached <= 1; cached++) {
+		double submit = 0;
+		double total = 0;
+		for (int frame = -BENCH_WARMUP_FRAMES; frame < frames; frame++) {
+			double start = GetTime();
+			BeginDrawing();
+			ClearBackground(RAYWHITE);
+			for (int i = 0; i < draws; i++) {
+				Vector2 position = { 10.0f + i * 5, 10.0f + i * 5 };
+				if (cached)
+					DrawTextLayout(layout, position, DARKGRAY);
+				else
+					DrawText(text.c_str(), (int) position.x, (int) position.y, 20, DARKGRAY);
+			}
+			double submitted = GetTime();
+			EndDrawing();
+
+			if (frame < 0)
+				continue;
+			submit += submitted - start;
+			total += GetTime() - start;
+		}
+		printf("BENCH: %-16s %5i glyphs x %2i: %8.3f ms/frame (submit %.3f ms)\n", cached ? "text-layout" : "text-drawtext", layout.quadsCount, draws, 1000 * total / frames, 1000 * submit / frames);
+	}
+	UnloadTextLayout(layout);
+}
+
+// Glyph lookup benchmark: text of CJK codepoints measured & drawn with a big synthetic font (1 pixel glyphs),
+// linear search of glyphs vs font lookup index
+void RunGlyphBenchmark(int glyphs, int length, int frames) {
+	Image pixel = GenImageColor(1, 1, WHITE);
+	Font font = { 0 };
+	font.baseSize = 16;
+	font.charsCount = glyphs;
+	font.texture = LoadTextureFromImage(pixel);
+	font.chars = (CharInfo*) MemAlloc(glyphs * sizeof(CharInfo));
+	font.recs = (Rectangle*) MemAlloc(glyphs * sizeof(Rectangle));
+	UnloadImage(pixel);
+	for (int i = 0; i < glyphs; i++) {
+		font.chars[i] = { 0x4E00 + i, 0, 0, 16, { 0 } };
+		font.recs[i] = { 0, 0, 1, 1 };
+	}
+
+	std::vector<int> codepoints(length);
+	for (int i = 0; i < length; i++)
+		codepoints[i] = i % 64 == 63 ? '\n' : 0x4E00 + (i * 7919) % glyphs;
+	char* text = TextToUtf8(codepoints.data(), length);
+
+	for (int indexed = 0; indexed <= 1; indexed++) {
+		if (indexed)
+			UpdateFontGlyphIndex(&font);
+		double measure = 0;
+		double draw = 0;
+		for (int frame = -BENCH_WARMUP_FRAMES; frame < frames; frame++) {
+			double start = GetTime();
+			MeasureTextEx(font, text, 16, 0);
+			double measured = GetTime();
+			BeginDrawing();
+			ClearBackground(RAYWHITE);
+			DrawTextEx(font, text, Vector2{ 10, 10 }, 16, 0, DARKGRAY);
+			double drawn = GetTime();
+			EndDrawing();
+
+			if (frame < 0)
+				continue;
+			measure += measured - start;
+			draw += drawn - measured;
+		}
+		printf("BENCH: %-16s %5i glyphs %5i chars: %8.3f ms measure, %8.3f ms draw\n", indexed ? "glyphs-index" : "glyphs-linear", glyphs, length, 1000 * measure / frames, 1000 * draw / frames);
+	}
+
+	MemFree(text);
+	UnloadFont(font);
+}
+
+// Load benchmark: game resources read from loose files (LoadFileData() copy) vs memory mapped asset pack (read in place),
+// then decoded from memory; asset pack built from resources into a temporary file
+void RunLoadBenchmark(int iterations) {
+	const char* files[] = { "images/icon.png", "images/github.png", "sounds/1.mp3", "sounds/2.mp3", "sounds/3.mp3", "sounds/4.mp3", "sounds/easter_egg.mp3" };
+	SetTraceLogLevel(LOG_WARNING); // Loading traces for every file otherwise
+	if (!ExportAssetPack(ASSET_PACK_DIRECTORY, BENCH_PACK_FILE)) {
+		SetTraceLogLevel(LOG_INFO);
+		return;
+	}
+
+	for (int packed = 0; packed <= 1; packed++) {
+		double read = 0;
+		double decode = 0;
+		unsigned int bytes = 0;
+		for (int i = 0; i < iterations; i++) {
+			double start = GetTime();
+			AssetPack pack = packed ? LoadAssetPack(BENCH_PACK_FILE) : AssetPack{ 0 };
+			read += GetTime() - start;
+			bytes = 0;
+
+			for (const char* file : files) {
+				double fileStart = GetTime();
+				unsigned int size = 0;
+				unsigned char* loaded = packed ? NULL : LoadFileData(TextFormat("%s/%s", ASSET_PACK_DIRECTORY, file), &size);
+				const unsigned char* data = packed ? GetAssetPackFileData(pack, file, &size) : loaded;
+				double fileRead = GetTime();
+
+				if (IsFileExtension(file, ".png"))
+					UnloadImage(LoadImageFromMemory(GetFileExtension(file), data, size));
+				else
+					UnloadWave(LoadWaveFromMemory(GetFileExtension(file), data, size));
+				UnloadFileData(loaded);
+
+				read += fileRead - fileStart;
+				decode += GetTime() - fileRead;
+				bytes += size;
+			}
+			UnloadAssetPack(pack);
+		}
+		printf("BENCH: %-16s %4i files %6.2f MB: %8.3f ms/load (read %.3f ms, decode %.3f ms)\n", packed ? "load-pack" : "load-files", (int) (sizeof(files) / sizeof(files[0])), bytes / 1048576.0, 1000 * (read + decode) / iterations, 1000 * read / iterations, 1000 * decode / iterations);
+	}
+
+	std::remove(BENCH_PACK_FILE);
+	SetTraceLogLevel(LOG_INFO);
+}
+
+// Compression benchmark: DXT1 (opaque) and DXT5 (alpha) encoding of a game image at every quality, with mipmaps
+// PSNR of base level against source image, size ratio against 32 bit RGBA
+void RunCompressionBenchmark(const char* fileName) {
+	const int formats[] = { COMPRESSED_DXT1_RGB, COMPRESSED_DXT5_RGBA };
+	const char* qualities[] = { "fast", "normal", "high" };
+	SetTraceLogLevel(LOG_WARNING);
+	Image source = LoadImage(fileName);
+	SetTraceLogLevel(LOG_INFO);
+	if (source.data == NULL)
+		return;
+	ImageFormat(&source, UNCOMPRESSED_R8G8B8A8);
+	ImageMipmaps(&source);
+
+	for (int format : formats) {
+		for (int quality = COMPRESSION_FAST; quality <= COMPRESSION_HIGH; quality++) {
+			SetImageCompressionQuality(quality);
+			Image compressed = ImageCopy(source);
+			double start = GetTime();
+			ImageFormat(&compressed, format);
+			double time = GetTime() - start;
+
+			printf("BENCH: %-16s %4i x %4i %2i mips: %8.3f ms (PSNR %.2f dB, size %.3f)\n", TextFormat("%s-%s", format == COMPRESSED_DXT1_RGB ? "dxt1" : "dxt5", qualities[quality]), source.width, source.height, source.mipmaps, 1000 * time, GetImagePSNR(compressed, source), (float) GetPixelDataSize(source.width, source.height, format) / GetPixelDataSize(source.width, source.height, source.format));
+			UnloadImage(compressed);
+		}
+	}
+
+	SetImageCompressionQuality(COMPRESSION_NORMAL);
+	UnloadImage(source);
+}
+
+// Half a second of noise, in device format (samples owned by the vector)
+Wave GenBenchNoiseWave(std::vector<float> &samples) {
+	Wave wave = { AUDIO_SAMPLE_RATE / 2 * AUDIO_CHANNELS, AUDIO_SAMPLE_RATE, 32, AUDIO_CHANNELS, NULL };
+	samples.resize(wave.sampleCount);
+	for (auto &sample : samples)
+		sample = randPos() / 4;
+	wave.data = samples.data();
+	return wave;
+}
+
+// Mixer benchmark: voices (generated sounds, played again when ended) mixed in real time on null backend audio device,
+// mixer load measured by raudio: voices per core extrapolated from load
+void RunAudioBenchmark(float seconds) {
+	InitAudioDeviceNull();
+	if (!IsAudioDeviceReady())
+		return;
+
+	std::vector<float> samples;
+	Wave wave = GenBenchNoiseWave(samples);
+
+	SetTraceLogLevel(LOG_WARNING);
+	std::vector<Sound> sounds;
+	for (int voices = 8; voices <= BENCH_AUDIO_VOICES_MAX; voices *= 4) {
+		while ((int) sounds.size() < voices)
+			sounds.push_back(LoadSoundFromWave(wave));
+
+		for (auto &sound : sounds)
+			PlaySound(sound);
+		std::this_thread::sleep_for(std::chrono::milliseconds(100)); // Every voice mixed
+		GetAudioMixingLoad();
+		auto start = std::chrono::steady_clock::now();
+		while (std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count() < seconds) {
+			for (auto &sound : sounds)
+				if (!IsSoundPlaying(sound))
+					PlaySound(sound);
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		}
+		float load = GetAudioMixingLoad();
+
+		printf("BENCH: %-16s %4i voices %4.1f s: %8.3f %% core (%.0f voices/core)\n", "audio-mix", voices, seconds, 100 * load, load > 0 ? voices / load : 0.0f);
+	}
+
+	for (auto &sound : sounds)
+		UnloadSound(sound);
+	SetTraceLogLevel(LOG_INFO);
+	CloseAudioDevice();
+}
+
+// Mixer throughput benchmark: same voices rendered offline (no device), one game frame of audio at a time, as fast as possible
+void RunAudioRenderBenchmark(int seconds) {
+	InitAudioDeviceOffline();
+	if (!IsAudioDeviceReady())
+		return;
+
+	std::vector<float> samples;
+	Wave wave = GenBenchNoiseWave(samples);
+	std::vector<float> frames(AUDIO_SAMPLE_RATE / FPS * AUDIO_CHANNELS);
+
+	SetTraceLogLevel(LOG_WARNING);
+	std::vector<Sound> sounds;
+	for (int voices = 8; voices <= BENCH_AUDIO_VOICES_MAX; voices *= 4) {
+		while ((int) sounds.size() < voices)
+			sounds.push_back(LoadSoundFromWave(wave));
+
+		for (auto &sound : sounds)
+			PlaySound(sound);
+		auto start = std::chrono::steady_clock::now();
+		for (int frame = 0; frame < seconds * FPS; frame++) {
+			for (auto &sound : sounds)
+				if (!IsSoundPlaying(sound))
+					PlaySound(sound);
+			RenderAudioFrames(frames.data(), AUDIO_SAMPLE_RATE / FPS);
+		}
+		float elapsed = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+
+		printf("BENCH: %-16s %4i voices %4i s: %8.3f ms (%.0fx real time)\n", "audio-render", voices, seconds, 1000 * elapsed, elapsed > 0 ? seconds / elapsed : 0.0f);
+	}
+
+	for (auto &sound : sounds)
+		UnloadSound(sound);
+	SetTraceLogLevel(LOG_INFO);
+	CloseAudioDevice();
+}
+
+// Audio threads stress (no sound output): sounds and an audio stream are played, stopped and changed (volume, pitch,
+// pan) by the game thread as fast as possible while the mixer runs on null backend audio device. Meant to be run with
+// raylib and the game built with ThreadSanitizer (see README), data races are reported by the sanitizer
+bool RunAudioStress(float seconds) {
+	InitAudioDeviceNull();
+	if (!IsAudioDeviceReady())
+		return false;
+
+	std::vector<float> samples;
+	Wave wave = GenBenchNoiseWave(samples);
+	std::vector<float> streamSamples(samples.begin(), samples.begin() + AUDIO_SAMPLE_RATE / FPS * AUDIO_CHANNELS);
+
+	SetTraceLogLevel(LOG_ERROR); // Commands queue full warnings expected
+	std::vector<Sound> sounds;
+	for (int i = 0; i < AUDIO_STRESS_SOUNDS; i++)
+		sounds.push_back(LoadSoundFromWave(wave));
+	AudioStream stream = InitAudioStream(AUDIO_SAMPLE_RATE, 32, AUDIO_CHANNELS);
+
+	long long iterations = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (; std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count() < seconds; iterations++) {
+		for (int i = 0; i < AUDIO_STRESS_SOUNDS; i++) {
+			Sound &sound = sounds[i];
+			switch ((iterations + i) % 6) {
+			case 0: PlaySound(sound); break;
+			case 1: SetSoundVolume(sound, (i + 1) / (float) AUDIO_STRESS_SOUNDS); break;
+			case 2: SetSoundPitch(sound, 0.5f + (i % 4) / 2.0f); break;
+			case 3: SetSoundPan(sound, (i % 3) / 2.0f); break;
+			case 4: PlaySoundMultiEx(sound, 0.5f, 1, SOUND_PRIORITY_COLLISION); break;
+			default: StopSound(sound); break;
+			}
+		}
+
+		// Stream stopped while its sub-buffers are updated: not available again until mixer has applied the stop
+		if (IsAudioStreamProcessed(stream))
+			UpdateAudioStream(stream, streamSamples.data(), (int) streamSamples.size());
+		if (iterations % 8 == 0)
+			StopAudioStream(stream);
+		else if (!IsAudioStreamPlaying(stream))
+			PlayAudioStream(stream);
+		SetAudioStreamVolume(stream, (iterations % 10) / 10.0f);
+		GetAudioMixingLoad();
+		std::this_thread::yield();
+	}
+	StopSoundMulti();
+
+	CloseAudioStream(stream);
+	for (auto &sound : sounds)
+		UnloadSound(sound);
+	SetTraceLogLevel(LOG_INFO);
+	CloseAudioDevice();
+
+	printf("AUDIO STRESS: passed (%lld iterations of %i sounds and a stream in %.1f s)\n", iterations, AUDIO_STRESS_SOUNDS, seconds);
+	return true;
+}
+
+// Collision sounds regression check: a fixed scene is simulated and its collision sounds are rendered offline (faster
+// than real time, no sound output), then compared with a reference WAV file, written instead when updating it
+// NOTE: Scene and sounds choice only depend on seeded random numbers, floating point results may still differ between
+// compilers and math libraries: a reference is updated after listening to it
+bool RunAudioCheck(const char* fileName, bool update) {
+	InitAudioDeviceOffline();
+	if (!IsAudioDeviceReady())
+		return false;
+
+	UseAssetPack(ASSET_PACK_FILE, ASSET_PACK_DIRECTORY);
+	AssetHandle sounds[4] = {
+		LoadSoundAsync("resources/sounds/1.mp3"),
+		LoadSoundAsync("resources/sounds/2.mp3"),
+		LoadSoundAsync("resources/sounds/3.mp3"),
+		LoadSoundAsync("resources/sounds/4.mp3")
+	};
+	while (GetAssetsPending() > 0) {
+		UpdateAssets(ASSET_UPLOAD_BUDGET);
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	SetMasterVolume(0.25);
+
+	seedRandom(0);
+	Balls balls;
+	Obstacles obstacles;
+	SetupGameObjects(balls, obstacles, AUDIO_CHECK_BALLS);
+
+	// Physics & audio stepped together: one game frame of audio per step
+	const int frameSamples = AUDIO_SAMPLE_RATE / FPS * AUDIO_CHANNELS;
+	std::vector<float> samples(AUDIO_CHECK_SECONDS * FPS * frameSamples);
+	std::vector<float> impacts;
+	for (int frame = 0; frame < AUDIO_CHECK_SECONDS * FPS; frame++) {
+		impacts.clear();
+		StepPhysics(balls, obstacles, 1.0f / FPS, &impacts);
+		PlayCollisionSounds(impacts, sounds);
+		RenderAudioFrames(samples.data() + frame * frameSamples, frameSamples / AUDIO_CHANNELS);
+	}
+
+	Wave rendered = { (unsigned int) samples.size(), AUDIO_SAMPLE_RATE, 32, AUDIO_CHANNELS, samples.data() };
+	Wave wave = WaveCopy(rendered);
+	WaveFormat(&wave, AUDIO_SAMPLE_RATE, 16, AUDIO_CHANNELS);
+
+	bool success = false;
+	if (update) {
+		success = ExportWave(wave, fileName);
+		printf("AUDIO CHECK: reference %s %s\n", fileName, success ? "updated" : "could not be written");
+	} else if (!FileExists(fileName))
+		printf("AUDIO CHECK: FAILED, reference %s not found (written by --audio-check-update)\n", fileName);
+	else {
+		Wave reference = LoadWave(fileName);
+		int difference = 0;
+		if (reference.sampleCount == wave.sampleCount && reference.sampleSize == 16 && reference.channels == wave.channels) {
+			for (unsigned int i = 0; i < wave.sampleCount; i++)
+				difference = std::max(difference, abs(((short*) wave.data)[i] - ((short*) reference.data)[i]));
+			success = difference <= AUDIO_CHECK_TOLERANCE;
+			printf("AUDIO CHECK: %s against %s (max difference %i)\n", success ? "passed" : "FAILED", fileName, difference);
+		} else
+			printf("AUDIO CHECK: FAILED, %s format differs from rendered audio\n", fileName);
+		UnloadWave(reference);
+	}
+
+	UnloadWave(wave);
+	UnloadAssets();
+	CloseAudioDevice();
+	return success;
+}
+
+// Renders music offline (no sound output), one game frame of audio at a time, either updated by UpdateMusicStream() or
+// decoded ahead by StartMusicDecoder() thread, optionally stopped and played again at restartFrame (game frame)
+static std::vector<float> RenderMusic(bool decoder, int frames, int restartFrame, unsigned int* musicFrames) {
+	const int frameSamples = AUDIO_SAMPLE_RATE / FPS * AUDIO_CHANNELS;
+	std::vector<float> samples(frames * frameSamples);
+
+	Music music = LoadMusicStream(MUSIC_CHECK_FILE);
+	music.looping = true;
+	*musicFrames = music.stream.channels > 0 ? music.sampleCount / music.stream.channels : 0;
+	if (music.stream.sampleRate != AUDIO_SAMPLE_RATE || (decoder && !StartMusicDecoder(music, MUSIC_CHECK_LATENCY)))
+		samples.clear(); // Music resampled: loop and restart would not be sample exact
+	PlayMusicStream(music);
+	for (int frame = 0; frame < frames && !samples.empty(); frame++) {
+		if (frame == restartFrame) {
+			StopMusicStream(music);
+			PlayMusicStream(music);
+		}
+		if (!decoder)
+			UpdateMusicStream(music);
+		RenderAudioFrames(samples.data() + frame * frameSamples, frameSamples / AUDIO_CHANNELS);
+	}
+	UnloadMusicStream(music);
+	return samples;
+}
+
+// Maximum difference between count samples of a (from aStart) and b (from bStart), infinite if out of range
+static float SamplesDifference(const std::vector<float> &a, size_t aStart, const std::vector<float> &b, size_t bStart, size_t count) {
+	if (aStart + count > a.size() || bStart + count > b.size())
+		return INFINITY;
+	float difference = 0;
+	for (size_t i = 0; i < count; i++)
+		difference = std::max(difference, fabsf(a[aStart + i] - b[bStart + i]));
+	return difference;
+}
+
+// Music decoder check, music rendered offline (mixer waits for decoder thread):
+// - decoded ahead against updated by UpdateMusicStream(), before music end (UpdateMusicStream() stops the stream as
+//   soon as music end is queued, last sub-buffer is not played)
+// - looping: played again from start once decoded to its end
+// - restart: StopMusicStream() then PlayMusicStream() plays again from start
+// Frame counters wrap around ring buffer capacity many times
+bool RunMusicCheck() {
+	InitAudioDeviceOffline();
+	if (!IsAudioDeviceReady())
+		return false;
+
+	const int frameSamples = AUDIO_SAMPLE_RATE / FPS * AUDIO_CHANNELS;
+	const int frames = MUSIC_CHECK_SECONDS * FPS;
+	unsigned int musicFrames = 0;
+	std::vector<float> updated = RenderMusic(false, frames, -1, &musicFrames);
+	std::vector<float> decoded = RenderMusic(true, frames, -1, &musicFrames);
+	std::vector<float> restarted = RenderMusic(true, frames, MUSIC_CHECK_RESTART_FRAME, &musicFrames);
+	CloseAudioDevice();
+
+	size_t musicSamples = musicFrames * AUDIO_CHANNELS;
+	size_t restartSamples = MUSIC_CHECK_RESTART_FRAME * frameSamples;
+	float differences[3] = {
+		SamplesDifference(decoded, 0, updated, 0, std::min(musicSamples, restartSamples)),
+		SamplesDifference(decoded, musicSamples, decoded, 0, musicSamples),
+		SamplesDifference(restarted, restartSamples, decoded, 0, musicSamples)
+	};
+	const char* names[3] = { "update", "loop", "restart" };
+
+	bool success = !updated.empty();
+	for (int i = 0; i < 3; i++) {
+		printf("MUSIC CHECK: %-8s max difference %g\n", names[i], differences[i]);
+		success = success && differences[i] <= MUSIC_CHECK_TOLERANCE;
+	}
+	printf("MUSIC CHECK: %s (%s, %u frames)\n", success ? "passed" : "FAILED", MUSIC_CHECK_FILE, musicFrames);
+	return success;
+}
+
+// Render benchmark: default scene and stress scenes, fixed time step, no frame limit
+// Optionally dumps every rendered frame as PNG into dumpDir
+void RunRenderBenchmark(int frames, const char* dumpDir, bool impostorsLoaded) {
+	struct BenchScene {
+		const char* name;
+		int nBalls;
+		int nObstaclesSide;
+		bool impostors;
+		bool threaded;
+	};
+	const BenchScene scenes[] = {
+		{ "default", 1, 3, false, false },
+		{ "stress-obstacles", 1, 12, false, false },
+		{ "stress-balls", 200, 3, false, false },
+		{ "stress", 200, 12, false, false },
+		{ "impostors", 200, 3, true, false },
+		{ "stress-impostors", 200, 12, true, false },
+		{ "stress-balls-mt", 200, 3, false, true },
+		{ "stress-mt", 200, 12, false, true },
+		{ "stress-impostors-mt", 200, 12, true, true }
+	};
+
+	Camera camera;
+	camera.position = Spherical{ 35, PI / 4, PI / 3 }.toCartesian();
+	camera.target = { 0.0f, 0.0f, 0.0f };
+	camera.up = { 0.0f, 1.0f, 0.0f };
+	camera.fovy = 45.0f;
+	camera.type = CAMERA_PERSPECTIVE;
+
+	SetTargetFPS(0);
+	printf("BENCH: %i x %i, %i frames per scene%s, %i draw threads\n", GetScreenWidth(), GetScreenHeight(), frames, IsWindowHeadless() ? " (headless)" : "", GetDrawThreadCount());
+
+	for (auto scene : scenes) {
+		if (scene.impostors && !impostorsLoaded)
+			continue;
+		seedRandom(0); // Same scene on every run
+		Balls balls;
+		Obstacles obstacles;
+		SetupGameObjects(balls, obstacles, scene.nBalls, scene.nObstaclesSide);
+
+		double total = 0;
+		double worst = 0;
+		long long allocations = 0;
+		for (int frame = -BENCH_WARMUP_FRAMES; frame < frames; frame++) {
+			if (frame == 0)
+				allocations = GetHeapAllocations();
+			double start = GetTime();
+
+			StepPhysics(balls, obstacles, 1.0f / FPS);
+			BeginDrawing();
+			ClearBackground(RAYWHITE);
+			BeginMode3D(camera);
+			DrawScene(balls, obstacles, scene.impostors, scene.threaded, camera.position);
+			EndMode3D();
+			EndDrawing();
+			ResetFrameArenas();
+
+			double elapsed = GetTime() - start;
+			if (frame < 0)
+				continue;
+			total += elapsed;
+			if (elapsed > worst)
+				worst = elapsed;
+
+			if (dumpDir != NULL)
+				TakeScreenshot(TextFormat("%s/%s_%04i.png", dumpDir, scene.name, frame));
+		}
+
+		const char* allocationsText = allocations >= 0 ? TextFormat("%.1f", (double) (GetHeapAllocations() - allocations) / frames) : "n/a"; // Not counted
+		printf("BENCH: %-16s %4i balls %4i obstacles: %8.3f ms/frame (worst %.3f ms, %s heap allocations/frame)\n", scene.name, (int) balls.size(), (int) obstacles.size(), 1000 * total / frames, 1000 * worst, allocationsText);
+	}
+}
+
+// Steady state heap allocations check (no window): physics steps and multi-threaded scene recording (vertices recorded
+// into command buffers but not submitted), frame arenas reset as after EndDrawing(). Every scene should do none
+bool RunAllocationCheck(int frames) {
+	struct CheckScene {
+		const char* name;
+		int nBalls;
+		int nObstaclesSide;
+	};
+	const CheckScene scenes[] = {
+		{ "default", 1, 3 },
+		{ "stress-balls", 200, 3 } // Dense obstacles scenes may hit the stuck ball bug (see README)
+	};
+
+	if (GetHeapAllocations() < 0) {
+		printf("ALLOC CHECK: FAILED, heap allocations not counted (build with COUNT_HEAP_ALLOCATIONS)\n");
+		return false;
+	}
+
+	bool success = true;
+	for (auto scene : scenes) {
+		seedRandom(0);
+		Balls balls;
+		Obstacles obstacles;
+		SetupGameObjects(balls, obstacles, scene.nBalls, scene.nObstaclesSide);
+		std::vector<float> impacts;
+		impacts.reserve(balls.size()); // One impact per ball at most
+
+		long long allocations = 0;
+		for (int frame = -BENCH_WARMUP_FRAMES; frame < frames; frame++) {
+			if (frame == 0)
+				allocations = GetHeapAllocations();
+			impacts.clear();
+			StepPhysics(balls, obstacles, 1.0f / FPS, &impacts);
+			RecordScene(balls, obstacles, false);
+			ResetFrameArenas();
+		}
+		allocations = GetHeapAllocations() - allocations;
+
+		printf("ALLOC CHECK: %-16s %4i balls %4i obstacles: %lld heap allocations in %i frames\n", scene.name, (int) balls.size(), (int) obstacles.size(), allocations, frames);
+		success = success && allocations == 0;
+	}
+	UnloadDrawThreads();
+
+	printf("ALLOC CHECK: %s\n", success ? "passed" : "FAILED");
+	return success;
+}
+
+// Image format conversion check (no window): ImageFormat() fast paths (SIMD kernels and their scalar tails) against the
+// generic conversion, for every uncompressed formats pair. Image sizes leave SIMD tails, the largest one holds every
+// 16 bit value. Both conversions must be bit-exact
+bool RunFormatCheck() {
+	const int sizes[FORMAT_CHECK_SIZES][2] = { { 1, 1 }, { 3, 5 }, { 7, 3 }, { 15, 17 }, { 31, 9 }, { 33, 65 }, { 259, 257 } };
+
+	int pairs = 0;
+	int failures = 0;
+	for (int format = UNCOMPRESSED_GRAYSCALE; format <= UNCOMPRESSED_R32G32B32A32; format++)
+		for (int newFormat = UNCOMPRESSED_GRAYSCALE; newFormat <= UNCOMPRESSED_R32G32B32A32; newFormat++) {
+			if (newFormat == format)
+				continue;
+			pairs++;
+			for (auto size : sizes) {
+				int width = size[0];
+				int height = size[1];
+				int dataSize = GetPixelDataSize(width, height, format);
+				unsigned char* data = (unsigned char*) RL_MALLOC(dataSize);
+
+				// Deterministic content: 16 bit values cover their whole range, floats are normalized (every 8 bit value
+				// and in-between values), bytes are hashed
+				unsigned int count = width * height;
+				if (format == UNCOMPRESSED_R5G6B5 || format == UNCOMPRESSED_R5G5B5A1 || format == UNCOMPRESSED_R4G4B4A4) {
+					for (unsigned int i = 0; i < count; i++)
+						((unsigned short*) data)[i] = (unsigned short) (i * 40503u); // Odd factor: all values once per 65536 pixels
+				} else if (format >= UNCOMPRESSED_R32) {
+					for (int i = 0; i < dataSize / (int) sizeof(float); i++) {
+						unsigned int hash = (unsigned int) i * 2654435761u;
+						((float*) data)[i] = (hash & 0x100) ? (hash >> 24) / 255.0f : (hash >> 16) / 65535.0f;
+					}
+				} else {
+					for (int i = 0; i < dataSize; i++)
+						data[i] = (unsigned char) (((unsigned int) i * 2654435761u) >> 24);
+				}
+
+				Image fast = { data, width, height, 1, format };
+				Image generic = ImageCopy(fast);
+				SetImageFormatFast(true);
+				ImageFormat(&fast, newFormat);
+				SetImageFormatFast(false);
+				ImageFormat(&generic, newFormat);
+				SetImageFormatFast(true);
+
+				int newSize = GetPixelDataSize(width, height, newFormat);
+				if (fast.format != newFormat || generic.format != newFormat || memcmp(fast.data, generic.data, newSize) != 0) {
+					int first = 0;
+					while (first < newSize && ((unsigned char*) fast.data)[first] == ((unsigned char*) generic.data)[first])
+						first++;
+					printf("FORMAT CHECK: %2i -> %2i %3i x %3i: fast path differs from generic conversion (byte %i)\n", format, newFormat, width, height, first);
+					failures++;
+				}
+				UnloadImage(fast);
+				UnloadImage(generic);
+			}
+		}
+
+	printf("FORMAT CHECK: %s (%i format pairs, %i image sizes, %i mismatches)\n", failures == 0 ? "passed" : "FAILED", pairs, FORMAT_CHECK_SIZES, failures);
+	return failures == 0;
+}
+
+// Audio mixing kernels check (no audio device): MixAudioSamples() and ClampAudioSamples() SIMD kernels (and their scalar
+// tails) against scalar code, for mono, stereo and quad samples, lengths leaving every tail size, unaligned buffers and
+// gains covering pan extremes. Samples past the end must be left untouched
+bool RunMixingCheck() {
+	const unsigned int channelCounts[] = { 1, 2, 4 };
+	const float gainSets[][4] = { { 1, 1, 1, 1 }, { 1, 0, 1, 0 }, { 0, 1, 0, 1 }, { 0.25f, 0.5f, 0.75f, 1 }, { 0, 0, 0, 0 } };
+	const unsigned int maxSamples = 67 * 4;
+
+	std::vector<float> input(maxSamples + 1), simd(maxSamples + 2), scalar(maxSamples + 2);
+	for (unsigned int i = 0; i < input.size(); i++)
+		input[i] = ((unsigned int) (i * 2654435761u) >> 16) / 65535.0f * 3 - 1.5f; // Out of range samples clamped
+
+	int checks = 0;
+	int failures = 0;
+	for (unsigned int channels : channelCounts)
+		for (auto &gains : gainSets)
+			for (unsigned int frames = 0; frames * channels <= maxSamples; frames++)
+				for (unsigned int offset = 0; offset < 2; offset++) { // Unaligned buffers
+					unsigned int count = frames * channels;
+					for (unsigned int i = 0; i < simd.size(); i++)
+						simd[i] = scalar[i] = input[(i * 7) % input.size()] / 2;
+
+					SetAudioMixingSimd(true);
+					MixAudioSamples(simd.data() + offset, input.data() + offset, count, gains, channels);
+					ClampAudioSamples(simd.data() + offset, count);
+					SetAudioMixingSimd(false);
+					MixAudioSamples(scalar.data() + offset, input.data() + offset, count, gains, channels);
+					ClampAudioSamples(scalar.data() + offset, count);
+					SetAudioMixingSimd(true);
+
+					float difference = 0;
+					for (unsigned int i = 0; i < simd.size(); i++)
+						difference = std::max(difference, fabsf(simd[i] - scalar[i]));
+					bool untouched = simd[offset + count] == input[((offset + count) * 7) % input.size()] / 2;
+					if (difference > MIX_CHECK_TOLERANCE || !untouched) {
+						printf("MIX CHECK: %u channels, %3u frames, offset %u: SIMD kernels differ from scalar code (max difference %g%s)\n", channels, frames, offset, difference, untouched ? "" : ", sample past the end changed");
+						failures++;
+					}
+					checks++;
+				}
+
+	printf("MIX CHECK: %s (%i kernel runs, %i mismatches)\n", failures == 0 ? "passed" : "FAILED", checks, failures);
+	return failures == 0;
+}
+
+// Image resize check (no window): ImageResize() and ImageMipmaps() (output rows strips resized in parallel, mipmaps
+// chained in place) on a single thread and on several threads, against plain stbir_resize_uint8() calls, for 1 to 4
+// channels and odd or NPOT sizes (large enough to be split between threads). Every result must be bit-exact
+bool RunResizeCheck() {
+	const int sizes[RESIZE_CHECK_SIZES][4] = { { 3, 5, 7, 9 }, { 301, 257, 517, 263 }, { 1001, 777, 333, 199 }, { 257, 255, 511, 509 }, { 1023, 517, 640, 360 } };
+	const int formats[4] = { UNCOMPRESSED_GRAYSCALE, UNCOMPRESSED_GRAY_ALPHA, UNCOMPRESSED_R8G8B8, UNCOMPRESSED_R8G8B8A8 };
+	const int threadCounts[2] = { 1, RESIZE_CHECK_THREADS };
+	int previousThreads = GetImageProcessingThreads();
+
+	int checks = 0;
+	int failures = 0;
+	for (int channels = 1; channels <= 4; channels++)
+		for (auto size : sizes) {
+			int width = size[0];
+			int height = size[1];
+			int dataSize = width * height * channels;
+			unsigned char* data = (unsigned char*) RL_MALLOC(dataSize);
+			for (int i = 0; i < dataSize; i++)
+				data[i] = (unsigned char) (((unsigned int) i * 2654435761u) >> 24);
+			Image source = { data, width, height, 1, formats[channels - 1] };
+
+			// References: single stbir_resize_uint8() call per image or mipmap level
+			std::vector<unsigned char> resized(size[2] * size[3] * channels);
+			stbir_resize_uint8(data, width, height, 0, resized.data(), size[2], size[3], 0, channels);
+			std::vector<unsigned char> mipmaps(data, data + dataSize);
+			for (int mipWidth = width, mipHeight = height, offset = 0; mipWidth > 1 || mipHeight > 1;) {
+				int newWidth = std::max(mipWidth / 2, 1);
+				int newHeight = std::max(mipHeight / 2, 1);
+				mipmaps.resize(mipmaps.size() + newWidth * newHeight * channels);
+				stbir_resize_uint8(mipmaps.data() + offset, mipWidth, mipHeight, 0, mipmaps.data() + offset + mipWidth * mipHeight * channels, newWidth, newHeight, 0, channels);
+				offset += mipWidth * mipHeight * channels;
+				mipWidth = newWidth;
+				mipHeight = newHeight;
+			}
+
+			for (int threads : threadCounts) {
+				SetImageProcessingThreads(threads);
+				Image image = ImageCopy(source);
+				ImageResize(&image, size[2], size[3]);
+				if (memcmp(image.data, resized.data(), resized.size()) != 0) {
+					printf("RESIZE CHECK: %i channels %4i x %4i -> %4i x %4i, %i threads: ImageResize() differs from stbir_resize_uint8()\n", channels, width, height, size[2], size[3], threads);
+					failures++;
+				}
+				UnloadImage(image);
+
+				image = ImageCopy(source);
+				ImageMipmaps(&image);
+				if (memcmp(image.data, mipmaps.data(), mipmaps.size()) != 0) {
+					printf("RESIZE CHECK: %i channels %4i x %4i, %i threads: ImageMipmaps() differs from stbir_resize_uint8() levels\n", channels, width, height, threads);
+					failures++;
+				}
+				UnloadImage(image);
+				checks += 2;
+			}
+			UnloadImage(source);
+		}
+	SetImageProcessingThreads(previousThreads);
+
+	printf("RESIZE CHECK: %s (%i resizes and mipmaps chains, 1 and %i threads, %i mismatches)\n", failures == 0 ? "passed" : "FAILED", checks, RESIZE_CHECK_THREADS, failures);
+	return failures == 0;
+}
+
+// Image drawing check (no window): ImageDraw() (32 bit RGBA rows blending, SIMD kernel and its scalar tail),
+// ImageDrawRectangleRec(), ImageDrawLine(), ImageDrawCircle() and ImageClearBackground() (packed pixel spans) against
+// per-pixel ImageDrawPixel(), SetPixelColor() and ColorAlphaBlend() references, for every uncompressed formats (and formats pair for
+// ImageDraw()), clipped and odd width shapes, pixels and tints alpha 0, 1, 254 and 255. Results must be bit-exact
+bool RunDrawCheck() {
+	const Color tints[DRAW_CHECK_TINTS] = { { 255, 255, 255, 255 }, { 255, 128, 64, 254 }, { 200, 100, 50, 1 }, { 17, 255, 128, 0 }, { 90, 180, 255, 128 } };
+	const Rectangle srcRecs[] = { { 0, 0, 23, 19 }, { 0, 0, 13, 11 }, { 0, 0, 23, 19 }, { 1, 2, 7, 5 }, { 0, 2, 20, 17 } }; // Left or top clipped: source from 0 (ImageDraw() restarts it at -dstRec.x, -dstRec.y)
+	const Vector2 dstPositions[] = { { 5, 3 }, { -4, -3 }, { 30, 20 }, { 9, 9 }, { -10, 12 } };
+	const Rectangle rectangles[] = { { 0, 0, 37, 29 }, { 3, 2, 1, 1 }, { 5, 4, 13, 7 }, { -5, -3, 11, 9 }, { 30, 25, 20, 20 }, { -2, 10, 50, 3 }, { 8, 8, 0, 5 } };
+	const int lines[][4] = { { 0, 0, 36, 28 }, { 2, 5, 33, 9 }, { -7, -3, 20, 4 }, { 10, 20, 50, 31 }, { 4, 3, 9, 27 }, { 3, 20, 30, 2 }, { 20, 5, 3, 5 } };
+	const int circles[][3] = { { 18, 14, 10 }, { 0, 0, 7 }, { 35, 27, 13 }, { 9, 17, 0 }, { 18, 14, 40 } };
+	const int width = 37, height = 29, srcWidth = 23, srcHeight = 19;
+
+	// Deterministic content: hashed RGBA bytes, alpha 0, 1, 254, 255 or hashed, converted to image format
+	auto makeImage = [](int width, int height, int format, unsigned int seed) {
+		const unsigned char alphas[4] = { 0, 1, 254, 255 };
+		Color* pixels = (Color*) RL_MALLOC(width * height * sizeof(Color));
+		for (int i = 0; i < width * height; i++) {
+			unsigned int hash = ((unsigned int) i + seed) * 2654435761u;
+			pixels[i] = { (unsigned char) (hash >> 24), (unsigned char) (hash >> 16), (unsigned char) (hash >> 8), (hash & 0x40) ? (unsigned char) hash : alphas[(hash >> 4) & 3] };
+		}
+		Image image = { pixels, width, height, 1, UNCOMPRESSED_R8G8B8A8 };
+		ImageFormat(&image, format);
+		return image;
+	};
+
+	int checks = 0;
+	int failures = 0;
+	auto compare = [&](const Image& image, const Image& reference, const char* function, int format, int index) {
+		checks++;
+		if (memcmp(image.data, reference.data, GetPixelDataSize(image.width, image.height, image.format)) != 0) {
+			printf("DRAW CHECK: %s() format %2i case %i differs from per-pixel reference\n", function, format, index);
+			failures++;
+		}
+	};
+
+	for (int format = UNCOMPRESSED_GRAYSCALE; format <= UNCOMPRESSED_R32G32B32A32; format++) {
+		Image background = makeImage(width, height, format, 0);
+
+		for (int srcFormat = UNCOMPRESSED_GRAYSCALE; srcFormat <= UNCOMPRESSED_R32G32B32A32; srcFormat++) {
+			Image src = makeImage(srcWidth, srcHeight, srcFormat, 12345);
+			int srcPixelSize = GetPixelDataSize(1, 1, srcFormat);
+			int pixelSize = GetPixelDataSize(1, 1, format);
+			for (Color tint : tints)
+				for (int i = 0; i < (int) (sizeof(srcRecs) / sizeof(srcRecs[0])); i++) {
+					Rectangle dstRec = { dstPositions[i].x, dstPositions[i].y, srcRecs[i].width, srcRecs[i].height };
+					Image image = ImageCopy(background);
+					ImageDraw(&image, src, srcRecs[i], dstRec, tint);
+
+					// Reference: no blend for opaque sources drawn with opaque tint, raw pixel copy if same format, pixels set
+					// as ImageDraw() does (SetPixelColor() leaves 32 bit float formats untouched)
+					bool blendRequired = !(tint.a == 255 && (srcFormat == UNCOMPRESSED_GRAYSCALE || srcFormat == UNCOMPRESSED_R8G8B8 || srcFormat == UNCOMPRESSED_R5G6B5));
+					Image reference = ImageCopy(background);
+					for (int y = 0; y < (int) srcRecs[i].height; y++)
+						for (int x = 0; x < (int) srcRecs[i].width; x++) {
+							int dstX = (int) dstRec.x + x;
+							int dstY = (int) dstRec.y + y;
+							if (dstX < 0 || dstX >= width || dstY < 0 || dstY >= height)
+								continue;
+							unsigned char* srcPixel = (unsigned char*) src.data + (((int) srcRecs[i].y + y) * srcWidth + (int) srcRecs[i].x + x) * srcPixelSize;
+							unsigned char* dstPixel = (unsigned char*) reference.data + (dstY * width + dstX) * pixelSize;
+							if (!blendRequired && srcFormat == format)
+								memcpy(dstPixel, srcPixel, pixelSize);
+							else {
+								Color color = GetPixelColor(srcPixel, srcFormat);
+								SetPixelColor(dstPixel, blendRequired ? ColorAlphaBlend(GetPixelColor(dstPixel, format), color, tint) : color, format);
+							}
+						}
+					compare(image, reference, "ImageDraw", format, srcFormat * 100 + i);
+					UnloadImage(image);
+					UnloadImage(reference);
+				}
+			UnloadImage(src);
+		}
+
+		for (Color color : tints) {
+			for (int i = 0; i < (int) (sizeof(rectangles) / sizeof(rectangles[0])); i++) {
+				Rectangle rec = rectangles[i];
+				Image image = ImageCopy(background);
+				ImageDrawRectangleRec(&image, rec, color);
+				Image reference = ImageCopy(background);
+				for (int y = std::max((int) rec.y, 0); y < std::min((int) rec.y + (int) rec.height, height); y++)
+					for (int x = std::max((int) rec.x, 0); x < std::min((int) rec.x + (int) rec.width, width); x++)
+						ImageDrawPixel(&reference, x, y, color);
+				compare(image, reference, "ImageDrawRectangleRec", format, i);
+				UnloadImage(image);
+				UnloadImage(reference);
+			}
+
+			for (int i = 0; i < (int) (sizeof(lines) / sizeof(lines[0])); i++) {
+				const int* line = lines[i];
+				Image image = ImageCopy(background);
+				ImageDrawLine(&image, line[0], line[1], line[2], line[3], color);
+
+				// Reference: Bresenham line, one pixel per column
+				Image reference = ImageCopy(background);
+				int m = 2 * (line[3] - line[1]);
+				int slopeError = m - (line[2] - line[0]);
+				for (int x = line[0], y = line[1]; x <= line[2]; x++) {
+					ImageDrawPixel(&reference, x, y, color);
+					slopeError += m;
+					if (slopeError >= 0) {
+						y++;
+						slopeError -= 2 * (line[2] - line[0]);
+					}
+				}
+				compare(image, reference, "ImageDrawLine", format, i);
+				UnloadImage(image);
+				UnloadImage(reference);
+			}
+
+			for (int i = 0; i < (int) (sizeof(circles) / sizeof(circles[0])); i++) {
+				int centerX = circles[i][0], centerY = circles[i][1], radius = circles[i][2];
+				Image image = ImageCopy(background);
+				ImageDrawCircle(&image, centerX, centerY, radius, color);
+
+				// Reference: midpoint circle, eight pixels per step
+				Image reference = ImageCopy(background);
+				int decision = 3 - 2 * radius;
+				for (int x = 0, y = radius; y >= x;) {
+					const int octants[8][2] = { { x, y }, { -x, y }, { x, -y }, { -x, -y }, { y, x }, { -y, x }, { y, -x }, { -y, -x } };
+					for (auto octant : octants)
+						ImageDrawPixel(&reference, centerX + octant[0], centerY + octant[1], color);
+					x++;
+					if (decision > 0) {
+						y--;
+						decision += 4 * (x - y) + 10;
+					} else
+						decision += 4 * x + 6;
+				}
+				compare(image, reference, "ImageDrawCircle", format, i);
+				UnloadImage(image);
+				UnloadImage(reference);
+			}
+
+			Image image = ImageCopy(background);
+			ImageClearBackground(&image, color);
+			Image reference = ImageCopy(background);
+			for (int y = 0; y < height; y++)
+				for (int x = 0; x < width; x++)
+					ImageDrawPixel(&reference, x, y, color);
+			compare(image, reference, "ImageClearBackground", format, 0);
+			UnloadImage(image);
+			UnloadImage(reference);
+		}
+		UnloadImage(background);
+	}
+
+	printf("DRAW CHECK: %s (%i drawings, %i mismatches)\n", failures == 0 ? "passed" : "FAILED", checks, failures);
+	return failures == 0;
+}
+
+// Image generation check (no window): GenImagePerlinNoise() (4 pixels per noise evaluation) and GenImageCellular()
+// (integer squared distances) rows strips, on a single thread and on several threads, against per-pixel
+// stb_perlin_fbm_noise3() and hypot() references. Image widths leave every 4 pixels tail, cellular images include
+// partial tiles and images smaller than a tile (no seed: white). Results must be bit-exact
+bool RunNoiseCheck() {
+	const int perlinSizes[][2] = { { 1, 1 }, { 7, 5 }, { 259, 257 }, { 301, 263 }, { 514, 131 }, { 1024, 67 } };
+	const float perlinParams[][3] = { { 0, 0, 1.0f }, { 50, 30, 4.0f }, { -77, 13, 10.5f } };
+	const int cellularSizes[][3] = { { 259, 257, 7 }, { 301, 263, 32 }, { 1023, 65, 64 }, { 257, 300, 300 }, { 7, 5, 16 }, { 1, 1, 1 } };
+	const int threadCounts[2] = { 1, NOISE_CHECK_THREADS };
+	int previousThreads = GetImageProcessingThreads();
+
+	int checks = 0;
+	int failures = 0;
+	for (int threads : threadCounts) {
+		SetImageProcessingThreads(threads);
+
+		for (auto size : perlinSizes)
+			for (auto params : perlinParams) {
+				int width = size[0];
+				int height = size[1];
+				int offsetX = (int) params[0];
+				int offsetY = (int) params[1];
+				float scale = params[2];
+				Image image = GenImagePerlinNoise(width, height, offsetX, offsetY, scale);
+
+				int mismatches = 0;
+				for (int y = 0; y < height; y++)
+					for (int x = 0; x < width; x++) {
+						float nx = (float) (x + offsetX) * scale / (float) width;
+						float ny = (float) (y + offsetY) * scale / (float) height;
+						float p = (stb_perlin_fbm_noise3(nx, ny, 1.0f, 2.0f, 0.5f, 6) + 1.0f) / 2.0f;
+						unsigned char intensity = (unsigned char) (int) (p * 255.0f);
+						Color color = ((Color*) image.data)[y * width + x];
+						if (color.r != intensity || color.g != intensity || color.b != intensity || color.a != 255)
+							mismatches++;
+					}
+				if (mismatches > 0) {
+					printf("NOISE CHECK: GenImagePerlinNoise() %4i x %3i scale %.1f, %i threads: %i pixels differ from stb_perlin_fbm_noise3()\n", width, height, scale, threads, mismatches);
+					failures++;
+				}
+				UnloadImage(image);
+				checks++;
+			}
+
+		for (auto size : cellularSizes) {
+			int width = size[0];
+			int height = size[1];
+			int tileSize = size[2];
+			srand(1234);
+			Image image = GenImageCellular(width, height, tileSize);
+
+			// Reference seeds: same random values sequence
+			int seedsPerRow = width / tileSize;
+			int seedsPerCol = height / tileSize;
+			std::vector<Vector2> seeds(seedsPerRow * seedsPerCol);
+			srand(1234);
+			for (int i = 0; i < (int) seeds.size(); i++) {
+				int y = (i / seedsPerRow) * tileSize + GetRandomValue(0, tileSize - 1);
+				int x = (i % seedsPerRow) * tileSize + GetRandomValue(0, tileSize - 1);
+				seeds[i] = { (float) x, (float) y };
+			}
+
+			int mismatches = 0;
+			for (int y = 0; y < height; y++)
+				for (int x = 0; x < width; x++) {
+					float minDistance = INFINITY;
+					for (int j = -1; j < 2; j++)
+						for (int i = -1; i < 2; i++) {
+							int tileX = x / tileSize + i;
+							int tileY = y / tileSize + j;
+							if (tileX < 0 || tileX >= seedsPerRow || tileY < 0 || tileY >= seedsPerCol)
+								continue;
+							Vector2 seed = seeds[tileY * seedsPerRow + tileX];
+							minDistance = std::min(minDistance, (float) hypot(x - (int) seed.x, y - (int) seed.y));
+						}
+					unsigned char intensity = (unsigned char) std::min(minDistance * 256.0f / tileSize, 255.0f);
+					Color color = ((Color*) image.data)[y * width + x];
+					if (color.r != intensity || color.g != intensity || color.b != intensity || color.a != 255)
+						mismatches++;
+				}
+			if (mismatches > 0) {
+				printf("NOISE CHECK: GenImageCellular() %4i x %3i tile %3i, %i threads: %i pixels differ from hypot() distances\n", width, height, tileSize, threads, mismatches);
+				failures++;
+			}
+			UnloadImage(image);
+			checks++;
+		}
+	}
+	SetImageProcessingThreads(previousThreads);
+
+	printf("NOISE CHECK: %s (%i images, 1 and %i threads, %i mismatches)\n", failures == 0 ? "passed" : "FAILED", checks, NOISE_CHECK_THREADS, failures);
+	return failures == 0;
+}
+
 int main(int argc, char* argv[]) {
+	// Command line: --bench [--frames N] [--dump DIR], --pack, --audio-check FILE, --audio-check-update FILE, --audio-stress, --alloc-check, --format-check, --mix-check, --music-check, --resize-check, --draw-check, --noise-check
+	bool benchmark = false;
+	int benchFrames = BENCH_FRAMES;
+	const char* dumpDir = NULL;
+	for (int i = 1; i < argc; i++) {
+		std::string arg = argv[i];
+		if (arg == "--bench")
+			benchmark = true;
+		else if (arg == "--frames" && i + 1 < argc)
+			benchFrames = std::max(1, atoi(argv[++i]));
+		else if (arg == "--dump" && i + 1 < argc)
+			dumpDir = argv[++i];
+		else if (arg == "--pack") // Asset pack tool: packs resources directory, then exits
+			return ExportAssetPack(ASSET_PACK_DIRECTORY, ASSET_PACK_FILE) ? EXIT_SUCCESS : EXIT_FAILURE;
+		else if (arg == "--audio-check" && i + 1 < argc) // Collision sounds regression check (no window), then exits
+			return RunAudioCheck(argv[++i], false) ? EXIT_SUCCESS : EXIT_FAILURE;
+		else if (arg == "--audio-check-update" && i + 1 < argc) // Collision sounds reference written (no window), then exits
+			return RunAudioCheck(argv[++i], true) ? EXIT_SUCCESS : EXIT_FAILURE;
+		else if (arg == "--audio-stress") // Audio threads stress on null audio device (no window), then exits
+			return RunAudioStress(AUDIO_STRESS_SECONDS) ? EXIT_SUCCESS : EXIT_FAILURE;
+		else if (arg == "--alloc-check") // Steady state heap allocations check (no window), then exits
+			return RunAllocationCheck(BENCH_FRAMES) ? EXIT_SUCCESS : EXIT_FAILURE;
+		else if (arg == "--format-check") // Image format conversion fast paths check (no window), then exits
+			return RunFormatCheck() ? EXIT_SUCCESS : EXIT_FAILURE;
+		else if (arg == "--resize-check") // Image resize and mipmaps parallel path check (no window), then exits
+			return RunResizeCheck() ? EXIT_SUCCESS : EXIT_FAILURE;
+		else if (arg == "--draw-check") // Image drawing spans and blending fast paths check (no window), then exits
+			return RunDrawCheck() ? EXIT_SUCCESS : EXIT_FAILURE;
+		else if (arg == "--noise-check") // Perlin noise and cellular images generation check (no window), then exits
+			return RunNoiseCheck() ? EXIT_SUCCESS : EXIT_FAILURE;
+		else if (arg == "--mix-check") // Audio mixing SIMD kernels check (no window, no audio device), then exits
+			return RunMixingCheck() ? EXIT_SUCCESS : EXIT_FAILURE;
+		else if (arg == "--music-check") // Music decoder thread check against UpdateMusicStream() (no window), then exits
+			return RunMusicCheck() ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
 	// Window initialization
 	float screenSizeCoef = .9f;
 	const int screenWidth = (int) roundf(1920 * screenSizeCoef);
@@ -203,29 +1367,51 @@ int main(int argc, char* argv[]) {
 
 	SetConfigFlags(FLAG_WINDOW_RESIZABLE);
 	InitWindow(screenWidth, screenHeight, "Bouncing Sphere - Jenny CAO & Théo SZANTO");
-	MaximizeWindow();
+	if (!benchmark && !IsWindowHeadless()) // Fixed framebuffer size for benchmarks & headless rendering
+		MaximizeWindow();
 	SetExitKey(-1);
 	SetTargetFPS(FPS);
 
-	// Images loading
-	Image icon = LoadImage("resources/images/icon.png");
-	SetWindowIcon(icon);
-	Image githubIcon = LoadImage("resources/images/github.png");
-	Texture2D github = LoadTextureFromImage(githubIcon);
-	UnloadImage(githubIcon);
-	UnloadImage(icon);
+	// Images loading, decoded in background: title screen is drawn without waiting for assets
+	UseAssetPack(ASSET_PACK_FILE, ASSET_PACK_DIRECTORY); // Loose files used if not packed
+	AssetHandle icon = LoadImageAsync("resources/images/icon.png");
+	AssetHandle github = LoadTextureAsync("resources/images/github.png");
+
+	// Sphere impostors (ray-marched balls), mesh drawing is used if not supported
+	bool impostorsLoaded = LoadSphereImpostors(TextFormat("resources/shaders/glsl%i/sphere_impostor.vs", GLSL_VERSION), TextFormat("resources/shaders/glsl%i/sphere_impostor.fs", GLSL_VERSION), DARKGRAY);
+	bool impostors = false;
+	bool threaded = false;
+
+	// Dynamic resolution (3D scene only), holds target frame rate on heavy scenes
+	SetDynamicResolutionConfig(DefaultDynamicResolutionConfig(FPS));
 
-	// Sound management
+	if (benchmark) {
+		RunRenderBenchmark(benchFrames, dumpDir, impostorsLoaded);
+		RunTextBenchmark(benchFrames);
+		RunGlyphBenchmark(BENCH_FONT_GLYPHS, BENCH_FONT_TEXT_LENGTH, benchFrames);
+		RunLoadBenchmark(BENCH_LOAD_ITERATIONS);
+		RunCompressionBenchmark(BENCH_COMPRESSION_IMAGE);
+		RunAudioBenchmark(BENCH_AUDIO_SECONDS);
+		RunAudioRenderBenchmark(BENCH_AUDIO_RENDER_SECONDS);
+		UnloadDrawThreads();
+		UnloadSphereImpostors();
+		UnloadAssets();
+		CloseWindow();
+		return EXIT_SUCCESS;
+	}
+
+	// Sound management, decoded in background (sounds not ready yet are not played)
 	InitAudioDevice();
-	Sound sounds[4] = {
-		LoadSound("resources/sounds/1.mp3"),
-		LoadSound("resources/sounds/2.mp3"),
-		LoadSound("resources/sounds/3.mp3"),
-		LoadSound("resources/sounds/4.mp3")
+	AssetHandle sounds[4] = {
+		LoadSoundAsync("resources/sounds/1.mp3"),
+		LoadSoundAsync("resources/sounds/2.mp3"),
+		LoadSoundAsync("resources/sounds/3.mp3"),
+		LoadSoundAsync("resources/sounds/4.mp3")
 	};
-	Sound easterEgg = LoadSound("resources/sounds/easter_egg.mp3");
+	AssetHandle easterEgg = LoadSoundAsync("resources/sounds/easter_egg.mp3");
 	SetMasterVolume(0.25);
 	bool soundEffects = false;
+	std::vector<float> impacts; // Collision impacts of the frame
 
 	// 3D Camera
 	Camera camera;
@@ -236,45 +1422,81 @@ int main(int argc, char* argv[]) {
 	camera.type = CAMERA_PERSPECTIVE;
 	SetCameraMode(camera, CAMERA_CUSTOM); // Set an orbital camera mode
 
+	// Constant texts, laid out once
+	TextLayout titleText = LoadText("Bouncing Sphere", 150);
+	TextLayout startText = LoadText("Press ENTER to start", 45);
+	TextLayout authorsText = LoadText("Jenny CAO & Théo SZANTO", 30);
+	TextLayout backText = LoadText("Press ESCAPE to go back to title screen", 30);
+	TextLayout pauseHelpText = LoadText("Press SPACE to toggle pause", 30);
+	TextLayout pauseText = LoadText("PAUSED", 45);
+
 	// Game objects
-	Ball ball;
+	Balls balls;
 	Obstacles obstacles;
 	int gameState = GAME_TITLE_SCREEN;
 
 	// Main game loop
 	while (!WindowShouldClose()) { // Detect window close button or ESC key
+		PROFILE_FRAME();
 		float deltaTime = min(GetFrameTime(), 2.0f / FPS); // Limit FPS loss to half of target
 
+		// Assets loaded in background: GPU & audio uploads
+		if (GetAssetsPending() > 0) {
+			UpdateAssets(ASSET_UPLOAD_BUDGET);
+			if (IsAssetReady(icon)) {
+				SetWindowIcon(GetAssetImage(icon));
+				UnloadAsset(icon);
+			}
+		}
+
 		if (IsKeyPressed(KEY_F1)) {
 			ToggleFullscreen();
 			if (IsWindowFullscreen()) // Bugfix to correctly update fullscreen mode & flags
 				ToggleFullscreen();
 		}
 
+		// Toggle profiler overlay
+		if (IsKeyPressed(KEY_F3))
+			PROFILE_TOGGLE();
+
+		// Toggle balls drawing: impostors / mesh
+		if (IsKeyPressed(KEY_F4) && impostorsLoaded)
+			impostors = !impostors;
+
+		// Toggle multi-threaded drawing
+		if (IsKeyPressed(KEY_F5))
+			threaded = !threaded;
+
+		// Toggle dynamic resolution
+		if (IsKeyPressed(KEY_F6))
+			SetDynamicResolution(!IsDynamicResolutionEnabled());
+		UpdateDynamicResolution(GetFrameWorkTime());
+
 		// Draw
 		BeginDrawing();
 		ClearBackground(RAYWHITE);
 
 		if (gameState == GAME_TITLE_SCREEN) {
+			PROFILE_SCOPE(PHASE_DRAW);
+
 			// Scene objects
-			const char* title = "Bouncing Sphere";
-			DrawText(title, GetScreenWidth() / 2 - MeasureText(title, 150) / 2, GetScreenHeight() / 2 - 75, 150, PINK);
-			const char* start = "Press ENTER to start";
-			DrawText(start, GetScreenWidth() / 2 - MeasureText(start, 45) / 2, GetScreenHeight() - 60, 45, DARKGRAY);
-			const char* authors = "Jenny CAO & Théo SZANTO";
-			DrawText(authors, 15, 15, 30, DARKGRAY);
-			DrawTexture(github, GetScreenWidth() - github.width - 15, 15, WHITE);
+			DrawTextLayout(titleText, { (float) (GetScreenWidth() / 2 - (int) titleText.size.x / 2), (float) (GetScreenHeight() / 2 - 75) }, PINK);
+			DrawTextLayout(startText, { (float) (GetScreenWidth() / 2 - (int) startText.size.x / 2), (float) (GetScreenHeight() - 60) }, DARKGRAY);
+			DrawTextLayout(authorsText, { 15, 15 }, DARKGRAY);
+			Texture2D githubTexture = GetAssetTexture(github); // Empty until loaded
+			DrawTexture(githubTexture, GetScreenWidth() - githubTexture.width - 15, 15, WHITE);
 
 			Vector2 mouse = GetMousePosition();
-			if (mouse.y < 30 + github.height && mouse.x > GetScreenWidth() - 30 - github.width) { // GitHub logo (window top right)
+			if (IsAssetReady(github) && mouse.y < 30 + githubTexture.height && mouse.x > GetScreenWidth() - 30 - githubTexture.width) { // GitHub logo (window top right)
 				SetMouseCursor(MOUSE_CURSOR_POINTING_HAND);
 				if (IsMouseButtonDown(MOUSE_LEFT_BUTTON))
 					OpenURL("https://github.com/JnyC-ToS/BouncingSphere");
-			} else if (mouse.y < 60 && mouse.x < 30 + MeasureText(authors, 30)) { // Easter Egg (window top left)
+			} else if (mouse.y < 60 && mouse.x < 30 + (int) authorsText.size.x) { // Easter Egg (window top left)
 				SetMouseCursor(MOUSE_CURSOR_POINTING_HAND);
 				if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
 					soundEffects = true;
-					PlaySoundMulti(easterEgg);
+					if (IsAssetReady(easterEgg))
+						PlaySoundMultiEx(GetAssetSound(easterEgg), 1, 1, SOUND_PRIORITY_EASTER_EGG);
 				}
 			} else
 				SetMouseCursor(MOUSE_CURSOR_ARROW);
@@ -282,59 +1504,78 @@ int main(int argc, char* argv[]) {
 			// Game start
 			if (IsKeyDown(KEY_ENTER)) {
 				gameState = GAME_RUNNING;
-				SetupGameObjects(ball, obstacles);
+				SetupGameObjects(balls, obstacles);
 			}
 		} else {
 			// Update camera
-			MyUpdateOrbitalCamera(&camera, deltaTime);
+			{
+				PROFILE_SCOPE(PHASE_INPUT);
+				MyUpdateOrbitalCamera(&camera, deltaTime);
+			}
 
+			BeginDynamicResolution(RAYWHITE);
 			BeginMode3D(camera);
 
 			// Game physics: only when window is focused and game is playing
 			if (deltaTime > 0 && IsWindowFocused() && gameState == GAME_RUNNING) {
-				// Gravity & rotation
-				ball.motion.y -= GRAVITY * deltaTime;
-				ball.rotation = ball.rotation * ball.rotationQuaternion;
-
-				// Collision
-				bool collide = MoveBall(&ball, obstacles, deltaTime);
-				if (collide && soundEffects)
-					PlaySoundMulti(sounds[rand() % 4]);
+				impacts.clear();
+				{
+					PROFILE_SCOPE(PHASE_PHYSICS);
+					StepPhysics(balls, obstacles, deltaTime, &impacts);
+				}
+				PROFILE_SCOPE(PHASE_AUDIO);
+				if (soundEffects)
+					PlayCollisionSounds(impacts, sounds);
 			}
 
 			// Object drawing
-			ball.draw();
-			for (auto obstacle : obstacles)
-				obstacle.draw();
-
-			EndMode3D();
+			{
+				PROFILE_SCOPE(PHASE_DRAW);
+				DrawScene(balls, obstacles, impostors, threaded, camera.position);
+				EndMode3D();
+				EndDynamicResolution();
+			}
 
 			// Back to title
-			const char* text = "Press ESCAPE to go back to title screen";
-			DrawText(text, GetScreenWidth() - MeasureText(text, 30) - 15, GetScreenHeight() - 45, 30, DARKGRAY);
+			DrawTextLayout(backText, { (float) (GetScreenWidth() - (int) backText.size.x - 15), (float) (GetScreenHeight() - 45) }, DARKGRAY);
 			if (IsKeyDown(KEY_ESCAPE))
 				gameState = GAME_TITLE_SCREEN;
 
 			// Toggle pause
-			DrawText("Press SPACE to toggle pause", 15, GetScreenHeight() - 45, 30, DARKGRAY);
+			DrawTextLayout(pauseHelpText, { 15, (float) (GetScreenHeight() - 45) }, DARKGRAY);
 			if (IsKeyPressed(KEY_SPACE))
 				gameState ^= 0b1;
 
+			// Balls drawing mode
+			if (impostorsLoaded) {
+				const char* mode = impostors ? "Balls: impostors (F4)" : "Balls: mesh (F4)";
+				DrawText(mode, GetScreenWidth() - MeasureText(mode, 20) - 15, 15, 20, DARKGRAY);
+			}
+			const char* threads = threaded ? TextFormat("Draw: %i threads (F5)", GetDrawThreadCount()) : "Draw: 1 thread (F5)";
+			DrawText(threads, GetScreenWidth() - MeasureText(threads, 20) - 15, 40, 20, DARKGRAY);
+			const char* resolution = IsDynamicResolutionEnabled() ? TextFormat("Resolution: %i%% dynamic (F6)", (int) roundf(100 * GetDynamicResolutionScale())) : "Resolution: 100% (F6)";
+			DrawText(resolution, GetScreenWidth() - MeasureText(resolution, 20) - 15, 65, 20, DARKGRAY);
+
 			// Pause indicator
 			if (gameState == GAME_PAUSED || !IsWindowFocused()) {
-				const char* pause = "PAUSED";
-				DrawText(pause, GetScreenWidth() / 2 - MeasureText(pause, 45) / 2, 15, 45, DARKGRAY);
+				DrawTextLayout(pauseText, { (float) (GetScreenWidth() / 2 - (int) pauseText.size.x / 2), 15 }, DARKGRAY);
 			}
 		}
 
+		PROFILE_DRAW(15, 60);
+
+		PROFILE_SCOPE(PHASE_PRESENT);
 		EndDrawing();
+		ResetFrameArenas(); // Transient drawing buffers released
 	}
 
 	// De-Initialization
-	for (auto sound : sounds)
-		UnloadSound(sound);
-	UnloadSound(easterEgg);
-	UnloadTexture(github);
+	for (auto text : { titleText, startText, authorsText, backText, pauseHelpText, pauseText })
+		UnloadTextLayout(text);
+	UnloadAssets(); // Before closing audio device & window
+	UnloadDrawThreads();
+	UnloadDynamicResolution();
+	UnloadSphereImpostors();
 	CloseAudioDevice();
 	CloseWindow(); // Close window and OpenGL context
 
@@ -1,35 +1,242 @@
 #include "Drawing.h"
 #include "Models.h"
 #include "rlgl.h"
+#include "raymath.h"
 #include "vector"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+// COMMAND BUFFERS
+
+// Recording state of the current thread: when a buffer is set, MyDraw* functions record transformed vertices into it
+// instead of pushing them into rlgl batch (same matrix stack behavior as rlgl: identity outside of any push)
+#define RECORD_MATRIX_STACK_SIZE 8
+#define SUBMIT_MAX_VERTICES 1536 // Multiple of 2 and 3: lines & triangles are never split
+
+static thread_local DrawCommandBuffer* recordBuffer = nullptr;
+static thread_local Matrix recordTransform;
+static thread_local Matrix recordStack[RECORD_MATRIX_STACK_SIZE];
+static thread_local int recordStackCounter = 0;
+static thread_local Color recordColor;
+
+void DrawCommandBuffer::clear() {
+	this->positions.clear();
+	this->colors.clear();
+	this->commands.clear();
+}
+
+void BeginDrawCommands(DrawCommandBuffer* buffer) {
+	buffer->clear();
+	recordBuffer = buffer;
+	recordTransform = MatrixIdentity();
+	recordStackCounter = 0;
+}
+
+void EndDrawCommands() {
+	recordBuffer = nullptr;
+}
+
+// Replays recorded vertices into rlgl batch, flushing it when full (main thread only)
+void SubmitDrawCommands(const DrawCommandBuffer& buffer) {
+	for (const DrawCommand& command : buffer.commands) {
+		for (int first = command.first; first < command.first + command.count; first += SUBMIT_MAX_VERTICES) {
+			int count = std::min(SUBMIT_MAX_VERTICES, command.first + command.count - first);
+			rlCheckRenderBatchLimit(count);
+
+			rlBegin(command.mode);
+			for (int v = first; v < first + count; v++) {
+				Color color = buffer.colors[v];
+				Vector3 position = buffer.positions[v];
+				rlColor4ub(color.r, color.g, color.b, color.a);
+				rlVertex3f(position.x, position.y, position.z);
+			}
+			rlEnd();
+		}
+	}
+}
+
+// Worker threads recording command buffers, created on first RecordDrawCommands() call
+// Jobs are claimed through an atomic counter: the calling thread works too and waits for workers still busy
+static std::vector<std::thread> recordWorkers;
+static std::mutex recordMutex;
+static std::condition_variable recordWake;
+static std::condition_variable recordDone;
+static const std::function<void(int)>* recordJob = nullptr; // Null when no jobs are running
+static int recordJobCount = 0;
+static std::atomic<int> recordNextJob(0);
+static int recordActiveWorkers = 0;
+static unsigned int recordGeneration = 0;
+static bool recordQuit = false;
+
+static void runRecordJobs(const std::function<void(int)>& job, int count) {
+	for (int i = recordNextJob++; i < count; i = recordNextJob++)
+		job(i);
+}
+
+static void recordWorker() {
+	unsigned int generation = 0;
+	std::unique_lock<std::mutex> lock(recordMutex);
+	while (true) {
+		recordWake.wait(lock, [&] { return recordQuit || (recordGeneration != generation && recordJob != nullptr); });
+		if (recordQuit)
+			return;
+		generation = recordGeneration;
+		const std::function<void(int)>& job = *recordJob;
+		int count = recordJobCount;
+		recordActiveWorkers++;
+		lock.unlock();
+
+		runRecordJobs(job, count);
+
+		lock.lock();
+		if (--recordActiveWorkers == 0)
+			recordDone.notify_all();
+	}
+}
+
+int GetDrawThreadCount() {
+	return std::max(1, std::min((int) std::thread::hardware_concurrency(), DRAW_THREADS_MAX));
+}
+
+void UnloadDrawThreads() {
+	{
+		std::lock_guard<std::mutex> lock(recordMutex);
+		recordQuit = true;
+	}
+	recordWake.notify_all();
+	for (auto& worker : recordWorkers)
+		worker.join();
+	recordWorkers.clear();
+	recordQuit = false;
+}
+
+void RecordDrawCommands(std::vector<DrawCommandBuffer>& buffers, const std::function<void(int)>& record) {
+	if (recordWorkers.empty()) {
+		int workers = GetDrawThreadCount() - 1;
+		for (int i = 0; i < workers; i++)
+			recordWorkers.emplace_back(recordWorker);
+	}
+
+	std::function<void(int)> job = [&](int i) {
+		BeginDrawCommands(&buffers[i]);
+		record(i);
+		EndDrawCommands();
+	};
+	int count = (int) buffers.size();
+	{
+		std::lock_guard<std::mutex> lock(recordMutex);
+		recordJob = &job;
+		recordJobCount = count;
+		recordNextJob = 0;
+		recordGeneration++;
+	}
+	recordWake.notify_all();
+
+	runRecordJobs(job, count);
+
+	// Every job is claimed: wait for the ones still running, late workers then find no job
+	std::unique_lock<std::mutex> lock(recordMutex);
+	recordDone.wait(lock, [] { return recordActiveWorkers == 0; });
+	recordJob = nullptr;
+}
+
+static void reserveVertices(int numVertex) {
+	if (recordBuffer != nullptr) {
+		size_t size = recordBuffer->positions.size() + numVertex;
+		if (size > recordBuffer->positions.capacity()) { // Geometric growth, buffers are reused from frame to frame
+			recordBuffer->positions.reserve(2 * size);
+			recordBuffer->colors.reserve(2 * size);
+		}
+	} else
+		rlCheckRenderBatchLimit(numVertex);
+}
+
+static void pushMatrix() {
+	if (recordBuffer == nullptr) {
+		rlPushMatrix();
+		return;
+	}
+	if (recordStackCounter < RECORD_MATRIX_STACK_SIZE)
+		recordStack[recordStackCounter] = recordTransform;
+	recordStackCounter++;
+}
+
+static void popMatrix() {
+	if (recordBuffer == nullptr) {
+		rlPopMatrix();
+		return;
+	}
+	if (recordStackCounter > 0) {
+		recordStackCounter--;
+		if (recordStackCounter < RECORD_MATRIX_STACK_SIZE)
+			recordTransform = recordStack[recordStackCounter];
+	}
+}
+
+static void beginPrimitives(int mode) {
+	if (recordBuffer == nullptr) {
+		rlBegin(mode);
+		return;
+	}
+	std::vector<DrawCommand>& commands = recordBuffer->commands;
+	if (commands.empty() || commands.back().mode != mode) // Consecutive primitives of same type are merged (as in rlgl)
+		commands.push_back({ mode, (int) recordBuffer->positions.size(), 0 });
+}
+
+static void endPrimitives() {
+	if (recordBuffer == nullptr)
+		rlEnd();
+}
+
+static void vertexColor(Color color) {
+	if (recordBuffer == nullptr)
+		rlColor4ub(color.r, color.g, color.b, color.a);
+	else
+		recordColor = color;
+}
 
 void prepareTransformationMatrix(Vector3 scale, Quaternion rotate, Vector3 translate) {
-	rlTranslatef(translate.x, translate.y, translate.z);
 	Vector3 vect;
 	float angle;
 	QuaternionToAxisAngle(rotate, &vect, &angle);
-	rlRotatef(angle * RAD2DEG, vect.x, vect.y, vect.z);
-	rlScalef(scale.x, scale.y, scale.z);
+	if (recordBuffer == nullptr) {
+		rlTranslatef(translate.x, translate.y, translate.z);
+		rlRotatef(angle * RAD2DEG, vect.x, vect.y, vect.z);
+		rlScalef(scale.x, scale.y, scale.z);
+	} else { // Same products as rlgl: recorded vertices are identical to immediate ones
+		recordTransform = MatrixMultiply(MatrixTranslate(translate.x, translate.y, translate.z), recordTransform);
+		recordTransform = MatrixMultiply(MatrixRotate(Vector3Normalize(vect), angle * RAD2DEG * DEG2RAD), recordTransform);
+		recordTransform = MatrixMultiply(MatrixScale(scale.x, scale.y, scale.z), recordTransform);
+	}
 }
 
 inline void vertex(Vector3 v) {
-	rlVertex3f(v.x, v.y, v.z);
+	if (recordBuffer == nullptr) {
+		rlVertex3f(v.x, v.y, v.z);
+		return;
+	}
+	recordBuffer->positions.push_back(recordStackCounter > 0 ? Vector3Transform(v, recordTransform) : v);
+	recordBuffer->colors.push_back(recordColor);
+	recordBuffer->commands.back().count++;
 }
 
 inline void vertex(float x, float y, float z) {
-	rlVertex3f(x, y, z);
+	vertex(Vector3{ x, y, z });
 }
 
 void MyDrawQuad(Quaternion q, Vector3 center, Vector2 size, Color color) {
 	int numVertex = 6;
-	if (rlCheckBufferLimit(numVertex))
-		rlglDraw();
+	reserveVertices(numVertex);
 
-	rlPushMatrix();
+	pushMatrix();
 	prepareTransformationMatrix({ size.x, 0, size.y }, q, center);
 
-	rlBegin(RL_TRIANGLES);
-	rlColor4ub(color.r, color.g, color.b, color.a);
+	beginPrimitives(RL_TRIANGLES);
+	vertexColor(color);
 
 	vertex(-1, 0, -1);
 	vertex(-1, 0, 1);
@@ -39,20 +246,19 @@ void MyDrawQuad(Quaternion q, Vector3 center, Vector2 size, Color color) {
 	vertex(-1, 0, 1);
 	vertex(1, 0, 1);
 
-	rlEnd();
-	rlPopMatrix();
+	endPrimitives();
+	popMatrix();
 }
 
 void MyDrawQuadWires(Quaternion q, Vector3 center, Vector2 size, Color color) {
 	int numVertex = 12;
-	if (rlCheckBufferLimit(numVertex))
-		rlglDraw();
+	reserveVertices(numVertex);
 
-	rlPushMatrix();
+	pushMatrix();
 	prepareTransformationMatrix({ size.x, 0, size.y }, q, center);
 
-	rlBegin(RL_LINES);
-	rlColor4ub(color.r, color.g, color.b, color.a);
+	beginPrimitives(RL_LINES);
+	vertexColor(color);
 
 	// BORDERS
 	vertex(-1, 0, -1);
@@ -74,8 +280,8 @@ void MyDrawQuadWires(Quaternion q, Vector3 center, Vector2 size, Color color) {
 	vertex(-1, 0, 1);
 	vertex(1, 0, -1);
 
-	rlEnd();
-	rlPopMatrix();
+	endPrimitives();
+	popMatrix();
 }
 
 void MyDrawSphere(Quaternion q, Vector3 center, float radius, int nSegmentsTheta, int nSegmentsPhi, Color color) {
@@ -89,19 +295,19 @@ void MyDrawSpherePortion(Quaternion q, Vector3 center, float radius, float start
 	float deltaPhi = (endPhi - startPhi) / nSegmentsPhi;
 	float deltaTheta = (endTheta - startTheta) / nSegmentsTheta;
 
-	std::vector<Vector3> vertexBufferTheta(nSegmentsTheta + 1);
+	FrameArenaScope scope;
+	FrameArray<Vector3> vertexBufferTheta = FrameAllocArray<Vector3>(nSegmentsTheta + 1);
 	for (int n = 0; n <= nSegmentsTheta; n++)
 		vertexBufferTheta[n] = Spherical{ 1, startTheta + n * deltaTheta, startPhi }.toCartesian();
 
 	int numVertex = nSegmentsPhi * nSegmentsTheta * 6;
-	if (rlCheckBufferLimit(numVertex))
-		rlglDraw();
+	reserveVertices(numVertex);
 
-	rlPushMatrix();
+	pushMatrix();
 	prepareTransformationMatrix({ radius, radius, radius }, q, center);
 
-	rlBegin(RL_TRIANGLES);
-	rlColor4ub(color.r, color.g, color.b, color.a);
+	beginPrimitives(RL_TRIANGLES);
+	vertexColor(color);
 
 	float phi = startPhi;
 	for (int i = 0; i < nSegmentsPhi; i++) {
@@ -131,8 +337,8 @@ void MyDrawSpherePortion(Quaternion q, Vector3 center, float radius, float start
 		vertexBufferTheta[nSegmentsTheta] = tmpBottomLeft;
 		phi = nextPhi;
 	}
-	rlEnd();
-	rlPopMatrix();
+	endPrimitives();
+	popMatrix();
 }
 
 void MyDrawSphereWires(Quaternion q, Vector3 center, float radius, int nSegmentsTheta, int nSegmentsPhi, Color color) {
@@ -146,19 +352,19 @@ void MyDrawSphereWiresPortion(Quaternion q, Vector3 center, float radius, float
 	float deltaPhi = (endPhi - startPhi) / nSegmentsPhi;
 	float deltaTheta = (endTheta - startTheta) / nSegmentsTheta;
 
-	std::vector<Vector3> vertexBufferTheta(nSegmentsTheta + 1);
+	FrameArenaScope scope;
+	FrameArray<Vector3> vertexBufferTheta = FrameAllocArray<Vector3>(nSegmentsTheta + 1);
 	for (int n = 0; n <= nSegmentsTheta; n++)
 		vertexBufferTheta[n] = Spherical{ 1, startTheta + n * deltaTheta, startPhi }.toCartesian();
 
 	int numVertex = nSegmentsPhi * (nSegmentsTheta * 4 + 2) + nSegmentsTheta * 2;
-	if (rlCheckBufferLimit(numVertex))
-		rlglDraw();
+	reserveVertices(numVertex);
 
-	rlPushMatrix();
+	pushMatrix();
 	prepareTransformationMatrix({ radius, radius, radius }, q, center);
 
-	rlBegin(RL_LINES);
-	rlColor4ub(color.r, color.g, color.b, color.a);
+	beginPrimitives(RL_LINES);
+	vertexColor(color);
 
 	float phi = startPhi;
 	for (int i = 0; i < nSegmentsPhi; i++) {
@@ -198,8 +404,8 @@ void MyDrawSphereWiresPortion(Quaternion q, Vector3 center, float radius, float
 		vertex(bottomRight);
 	}
 
-	rlEnd();
-	rlPopMatrix();
+	endPrimitives();
+	popMatrix();
 }
 
 void MyDrawCylinder(Quaternion q, Vector3 start, Vector3 end, float radius, int nSegments, int capsType, Color color) {
@@ -211,17 +417,16 @@ void MyDrawCylinderPortion(Quaternion q, Vector3 start, Vector3 end, float radiu
 		return;
 
 	int numVertex = nSegments * 6;
-	if (rlCheckBufferLimit(numVertex))
-		rlglDraw();
+	reserveVertices(numVertex);
 
-	rlPushMatrix();
+	pushMatrix();
 	Vector3 axis = Vector3Subtract(end, start);
 	Quaternion q1 = QuaternionFromVector3ToVector3({ 0, 1, 0 }, Vector3Normalize(axis));
 	Quaternion qf = QuaternionMultiply(q, q1);
 	prepareTransformationMatrix({ radius, Vector3Length(axis), radius }, qf, start);
 
-	rlBegin(RL_TRIANGLES);
-	rlColor4ub(color.r, color.g, color.b, color.a);
+	beginPrimitives(RL_TRIANGLES);
+	vertexColor(color);
 
 	float delta = (endSegments - startSegments) / nSegments;
 
@@ -254,8 +459,8 @@ void MyDrawCylinderPortion(Quaternion q, Vector3 start, Vector3 end, float radiu
 		MyDrawDiskPortion(QuaternionIdentity(), { 0, 1, 0 }, 1, startSegments, endSegments, nSegments, color);
 	}
 
-	rlEnd();
-	rlPopMatrix();
+	endPrimitives();
+	popMatrix();
 
 	if (capsType == CYLINDER_CAPS_ROUNDED) {
 		MyDrawSpherePortion(qf, start, radius, startSegments, endSegments, nSegments, PI / 2, PI, nSegments / 4, color);
@@ -272,17 +477,16 @@ void MyDrawCylinderWiresPortion(Quaternion q, Vector3 start, Vector3 end, float
 		return;
 
 	int numVertex = nSegments * (2 + (capsType == CYLINDER_CAPS_FLAT ? 0 : 4)) + 2;
-	if (rlCheckBufferLimit(numVertex))
-		rlglDraw();
+	reserveVertices(numVertex);
 
-	rlPushMatrix();
+	pushMatrix();
 	Vector3 axis = Vector3Subtract(end, start);
 	Quaternion q1 = QuaternionFromVector3ToVector3({ 0, 1, 0 }, Vector3Normalize(axis));
 	Quaternion qf = QuaternionMultiply(q, q1);
 	prepareTransformationMatrix({ radius, Vector3Length(axis), radius }, qf, start);
 
-	rlBegin(RL_LINES);
-	rlColor4ub(color.r, color.g, color.b, color.a);
+	beginPrimitives(RL_LINES);
+	vertexColor(color);
 
 	float delta = (endSegments - startSegments) / nSegments;
 
@@ -324,8 +528,8 @@ void MyDrawCylinderWiresPortion(Quaternion q, Vector3 start, Vector3 end, float
 		MyDrawDiskWiresPortion(QuaternionIdentity(), { 0, 1, 0 }, 1, startSegments, endSegments, nSegments, color);
 	}
 
-	rlEnd();
-	rlPopMatrix();
+	endPrimitives();
+	popMatrix();
 
 	if (capsType == CYLINDER_CAPS_ROUNDED) {
 		MyDrawSphereWiresPortion(qf, start, radius, startSegments, endSegments, nSegments, PI / 2, PI, nSegments / 4, color);
@@ -342,14 +546,13 @@ void MyDrawDiskPortion(Quaternion q, Vector3 center, float radius, float startSe
 		return;
 
 	int numVertex = nSegments * 3;
-	if (rlCheckBufferLimit(numVertex))
-		rlglDraw();
+	reserveVertices(numVertex);
 
-	rlPushMatrix();
+	pushMatrix();
 	prepareTransformationMatrix({ radius, 0, radius }, q, center);
 
-	rlBegin(RL_TRIANGLES);
-	rlColor4ub(color.r, color.g, color.b, color.a);
+	beginPrimitives(RL_TRIANGLES);
+	vertexColor(color);
 
 	float delta = (endSegments - startSegments) / nSegments;
 
@@ -368,8 +571,8 @@ void MyDrawDiskPortion(Quaternion q, Vector3 center, float radius, float startSe
 		theta = nextTheta;
 		tmpLeft = right;
 	}
-	rlEnd();
-	rlPopMatrix();
+	endPrimitives();
+	popMatrix();
 }
 
 void MyDrawDiskWires(Quaternion q, Vector3 center, float radius, int nSegments, Color color) {
@@ -381,14 +584,13 @@ void MyDrawDiskWiresPortion(Quaternion q, Vector3 center, float radius, float st
 		return;
 
 	int numVertex = nSegments * 4 + 2;
-	if (rlCheckBufferLimit(numVertex))
-		rlglDraw();
+	reserveVertices(numVertex);
 
-	rlPushMatrix();
+	pushMatrix();
 	prepareTransformationMatrix({ radius, 0, radius }, q, center);
 
-	rlBegin(RL_LINES);
-	rlColor4ub(color.r, color.g, color.b, color.a);
+	beginPrimitives(RL_LINES);
+	vertexColor(color);
 
 	float delta = (endSegments - startSegments) / nSegments;
 
@@ -415,6 +617,121 @@ void MyDrawDiskWiresPortion(Quaternion q, Vector3 center, float radius, float st
 	vertex(0, 0, 0);
 	vertex(right);
 
-	rlEnd();
-	rlPopMatrix();
+	endPrimitives();
+	popMatrix();
+}
+
+// IMPOSTORS
+
+// Sphere impostors: one camera-facing quad (4 vertices) per sphere, the fragment shader computes the exact
+// ray-sphere intersection, depth and latitude/longitude wires (20x20, as MyDrawSphereWires)
+// Vertex attributes: position = center, texcoord = quad corner, texcoord2.x = radius, tangent = rotation quaternion
+#define IMPOSTORS_MAX 16384 // 16 bits indices
+
+static Shader impostorShader = { 0 };
+static Material impostorMaterial = { 0 };
+static Mesh impostorMesh = { 0 };
+static int impostorCapacity = 0;
+static int impostorCount = 0;
+static int impostorViewPosLoc = -1;
+
+// Reallocates the impostors mesh (RAM and VRAM) keeping queued spheres
+static void GrowSphereImpostors(int capacity) {
+	static const float corners[] = { -1, -1, 1, -1, 1, 1, -1, 1 };
+
+	Mesh mesh = { 0 };
+	mesh.vertexCount = capacity * 4;
+	mesh.triangleCount = capacity * 2;
+	mesh.vertices = (float*) MemAlloc(mesh.vertexCount * 3 * sizeof(float));
+	mesh.texcoords = (float*) MemAlloc(mesh.vertexCount * 2 * sizeof(float));
+	mesh.texcoords2 = (float*) MemAlloc(mesh.vertexCount * 2 * sizeof(float));
+	mesh.tangents = (float*) MemAlloc(mesh.vertexCount * 4 * sizeof(float));
+	mesh.colors = (unsigned char*) MemAlloc(mesh.vertexCount * 4 * sizeof(unsigned char));
+	mesh.indices = (unsigned short*) MemAlloc(mesh.triangleCount * 3 * sizeof(unsigned short));
+
+	for (int i = 0; i < capacity; i++) {
+		memcpy(mesh.texcoords + i * 8, corners, sizeof(corners));
+		unsigned short first = (unsigned short) (i * 4);
+		unsigned short quad[] = { first, (unsigned short) (first + 1), (unsigned short) (first + 2), first, (unsigned short) (first + 2), (unsigned short) (first + 3) };
+		memcpy(mesh.indices + i * 6, quad, sizeof(quad));
+	}
+
+	if (impostorCapacity > 0) {
+		int n = impostorCount * 4;
+		memcpy(mesh.vertices, impostorMesh.vertices, n * 3 * sizeof(float));
+		memcpy(mesh.texcoords2, impostorMesh.texcoords2, n * 2 * sizeof(float));
+		memcpy(mesh.tangents, impostorMesh.tangents, n * 4 * sizeof(float));
+		memcpy(mesh.colors, impostorMesh.colors, n * 4 * sizeof(unsigned char));
+		UnloadMesh(impostorMesh);
+	}
+
+	rlLoadMesh(&mesh, true);
+	impostorMesh = mesh;
+	impostorCapacity = capacity;
+}
+
+// Returns false if impostor shader could not be loaded (mesh drawing must be used)
+bool LoadSphereImpostors(const char* vsFileName, const char* fsFileName, Color wireColor) {
+	impostorShader = LoadShader(vsFileName, fsFileName);
+	if (impostorShader.id == GetShaderDefault().id)
+		return false;
+
+	impostorViewPosLoc = GetShaderLocation(impostorShader, "viewPos");
+	Vector4 wire = { wireColor.r / 255.0f, wireColor.g / 255.0f, wireColor.b / 255.0f, wireColor.a / 255.0f };
+	SetShaderValue(impostorShader, GetShaderLocation(impostorShader, "wireColor"), &wire, UNIFORM_VEC4);
+
+	impostorMaterial = LoadMaterialDefault();
+	impostorMaterial.shader = impostorShader;
+	GrowSphereImpostors(64);
+	return true;
+}
+
+void UnloadSphereImpostors() {
+	if (impostorCapacity == 0)
+		return;
+	UnloadMesh(impostorMesh);
+	UnloadMaterial(impostorMaterial); // Unloads impostor shader
+	impostorMesh = { 0 };
+	impostorCapacity = 0;
+	impostorCount = 0;
+}
+
+// Queues a sphere, drawn by next MyDrawSphereImpostors() call
+void MyDrawSphereImpostor(Quaternion q, Vector3 center, float radius, Color color) {
+	if (impostorCount == impostorCapacity) {
+		if (impostorCapacity == IMPOSTORS_MAX)
+			return;
+		GrowSphereImpostors(std::min(impostorCapacity * 2, IMPOSTORS_MAX));
+	}
+
+	for (int v = impostorCount * 4; v < impostorCount * 4 + 4; v++) {
+		memcpy(impostorMesh.vertices + v * 3, &center, 3 * sizeof(float));
+		impostorMesh.texcoords2[v * 2] = radius;
+		impostorMesh.texcoords2[v * 2 + 1] = 0;
+		memcpy(impostorMesh.tangents + v * 4, &q, 4 * sizeof(float));
+		memcpy(impostorMesh.colors + v * 4, &color, 4 * sizeof(unsigned char));
+	}
+	impostorCount++;
+}
+
+// Draws all queued spheres in a single draw call
+void MyDrawSphereImpostors(Vector3 viewPos) {
+	if (impostorCount == 0)
+		return;
+
+	int n = impostorCount * 4;
+	rlUpdateMesh(impostorMesh, 0, n);
+	rlUpdateMesh(impostorMesh, 3, n);
+	rlUpdateMesh(impostorMesh, 4, n);
+	rlUpdateMesh(impostorMesh, 5, n);
+
+	SetShaderValue(impostorShader, impostorViewPosLoc, &viewPos, UNIFORM_VEC3);
+
+	Mesh mesh = impostorMesh;
+	mesh.vertexCount = n;
+	mesh.triangleCount = impostorCount * 2;
+	rlglDraw(); // Keep drawing order with batched geometry
+	rlDrawMesh(mesh, impostorMaterial, MatrixIdentity());
+
+	impostorCount = 0;
 }
@@ -1,6 +1,10 @@
 #ifndef __DRAWING_H__
 #define __DRAWING_H__
 #include "raylib.h"
+#include <functional>
+#include <vector>
+
+#define DRAW_THREADS_MAX 16 // Command buffers recording threads (calling thread included)
 
 // PLAIN OBJECTS
 
@@ -27,4 +31,38 @@ void MyDrawCylinderWiresPortion(Quaternion q, Vector3 start, Vector3 end, float
 void MyDrawDiskPortion(Quaternion q, Vector3 center, float radius, float startSegments, float endSegments, int nSegments, Color color);
 void MyDrawDiskWiresPortion(Quaternion q, Vector3 center, float radius, float startSegments, float endSegments, int nSegments, Color color);
 
+// IMPOSTORS
+
+bool LoadSphereImpostors(const char* vsFileName, const char* fsFileName, Color wireColor);
+void UnloadSphereImpostors();
+
+void MyDrawSphereImpostor(Quaternion q, Vector3 center, float radius, Color color);
+void MyDrawSphereImpostors(Vector3 viewPos);
+
+// COMMAND BUFFERS
+
+// Vertices recorded by MyDraw* functions on any thread (positions already transformed), replayed into rlgl batch by SubmitDrawCommands()
+struct DrawCommand {
+	int mode; // RL_LINES or RL_TRIANGLES
+	int first;
+	int count;
+};
+
+struct DrawCommandBuffer {
+	std::vector<Vector3> positions;
+	std::vector<Color> colors;
+	std::vector<DrawCommand> commands;
+
+	void clear();
+};
+
+void BeginDrawCommands(DrawCommandBuffer* buffer); // MyDraw* functions of calling thread record into buffer (cleared)
+void EndDrawCommands();
+void SubmitDrawCommands(const DrawCommandBuffer& buffer); // Main thread only
+
+// Calls record(i) for every buffer on worker threads, each call recording into buffers[i]; returns when all are recorded
+void RecordDrawCommands(std::vector<DrawCommandBuffer>& buffers, const std::function<void(int)>& record);
+int GetDrawThreadCount();
+void UnloadDrawThreads();
+
 #endif
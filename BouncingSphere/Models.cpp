@@ -203,7 +203,8 @@ bool IntersectSegmentBoxRounded(Segment segment, BoxRounded box, Vector3& interP
 	Vector3 interNormalClosest;
 	Vector3 interPtTest;
 	Vector3 interNormalTest;
-	std::vector<Quad> quads = box.listQuads();
+	FrameArenaScope scope;
+	FrameArray<Quad> quads = box.listQuads();
 	for (auto quad : quads) {
 		if (IntersectSegmentQuad(segment, quad, interPtTest, interNormalTest)) {
 			float distTest = ~(interPtTest - segment.pt1);
@@ -214,7 +215,7 @@ bool IntersectSegmentBoxRounded(Segment segment, BoxRounded box, Vector3& interP
 			}
 		}
 	}
-	std::vector<Cylinder> cylinders = box.listCylinders();
+	FrameArray<Cylinder> cylinders = box.listCylinders();
 	for (auto cylinder : cylinders) {
 		if (IntersectSegmentCylinderRounded(segment, cylinder, interPtTest, interNormalTest)) {
 			float distTest = ~(interPtTest - segment.pt1);
@@ -245,8 +245,9 @@ struct BoxRounded {
 	Vector3 ext;
 	float r;
 
-	std::vector<Quad> listQuads() {
-		std::vector<Quad> quads(6);
+	// Frame arena arrays: valid until the end of the caller FrameArenaScope
+	FrameArray<Quad> listQuads() {
+		FrameArray<Quad> quads = FrameAllocArray<Quad>(6);
 		quads[0] = { this->ref + Vector3{ 0, this->ext.y + this->r, 0 }, { this->ext.x, this->ext.z } }; // Top
 		quads[1] = { (this->ref + Vector3{ 0, -(this->ext.y + this->r), 0 }) * QuaternionFromAxisAngle(this->ref.i, PI), { this->ext.x, this->ext.z } }; // Bottom
 		quads[2] = { (this->ref + Vector3{ this->ext.x + this->r, 0, 0 }) * QuaternionFromAxisAngle(this->ref.k, -PI / 2), { this->ext.y, this->ext.z } }; // Right
@@ -256,8 +257,8 @@ struct BoxRounded {
 		return quads;
 	}
 
-	std::vector<Cylinder> listCylinders() {
-		std::vector<Cylinder> cylinders(12);
+	FrameArray<Cylinder> listCylinders() {
+		FrameArray<Cylinder> cylinders = FrameAllocArray<Cylinder>(12);
 		Vector3 bottomFrontLeft = this->ref.origin + this->ref.i * -this->ext.x + this->ref.j * -this->ext.y + this->ref.k * this->ext.z;
 		Vector3 bottomFrontRight = this->ref.origin + this->ref.i * this->ext.x + this->ref.j * -this->ext.y + this->ref.k * this->ext.z;
 		Vector3 bottomBackLeft = this->ref.origin + this->ref.i * -this->ext.x + this->ref.j * -this->ext.y + this->ref.k * -this->ext.z;
@@ -285,11 +286,12 @@ struct BoxRounded {
 	}
 
 	void draw(Color color) {
-		std::vector<Quad> quads = this->listQuads();
+		FrameArenaScope scope;
+		FrameArray<Quad> quads = this->listQuads();
 		for (auto quad : quads)
 			quad.draw(color);
 		if (this->r > EPSILON) {
-			std::vector<Cylinder> cylinders = this->listCylinders();
+			FrameArray<Cylinder> cylinders = this->listCylinders();
 			for (auto cylinder : cylinders)
 				cylinder.draw(color, CYLINDER_CAPS_ROUNDED);
 		}
@@ -0,0 +1,116 @@
+#include "Profiler.h"
+
+#if defined(PROFILER)
+
+#include "raylib.h"
+#include "rlgl.h"
+#include <algorithm>
+
+#define PROFILER_GRAPH_HEIGHT 60
+#define PROFILER_GRAPH_SCALE_MS 33.3f // Graph full height (2 frames at 60 FPS)
+
+static const char* phaseNames[PHASE_COUNT] = { "Input & camera", "Physics", "Audio", "Draw", "Present" };
+static const Color phaseColors[PHASE_COUNT] = { SKYBLUE, ORANGE, PURPLE, LIME, GRAY };
+
+struct ProfilerFrame {
+	double phases[PHASE_COUNT];
+	double total;
+};
+
+static ProfilerFrame history[PROFILER_HISTORY];
+static ProfilerFrame current;
+static double frameStart = 0;
+static int frameIndex = 0; // Next history slot
+static int frameCount = 0; // Valid frames in history
+static bool visible = false;
+
+ProfilerScope::ProfilerScope(ProfilerPhase phase) : phase(phase), start(GetTime()) {}
+
+ProfilerScope::~ProfilerScope() {
+	current.phases[this->phase] += GetTime() - this->start;
+}
+
+// Closes the current frame and stores it into history
+void ProfilerNewFrame() {
+	double now = GetTime();
+	if (frameStart > 0) {
+		current.total = now - frameStart;
+		history[frameIndex] = current;
+		frameIndex = (frameIndex + 1) % PROFILER_HISTORY;
+		frameCount = std::min(frameCount + 1, PROFILER_HISTORY);
+	}
+	current = {};
+	frameStart = now;
+}
+
+void ProfilerToggle() {
+	visible = !visible;
+}
+
+// Percentile of frame total times in history (p in [0, 1])
+static double FramePercentile(float p) {
+	double totals[PROFILER_HISTORY];
+	for (int i = 0; i < frameCount; i++)
+		totals[i] = history[i].total;
+	int k = std::min(frameCount - 1, (int) (p * frameCount));
+	std::nth_element(totals, totals + k, totals + frameCount);
+	return totals[k];
+}
+
+void DrawProfiler(int x, int y) {
+	if (!visible || frameCount == 0)
+		return;
+
+	const int width = PROFILER_HISTORY * 2 + 20;
+	const int height = 20 * (PHASE_COUNT + 5) + PROFILER_GRAPH_HEIGHT + 20;
+	DrawRectangle(x, y, width, height, Fade(BLACK, 0.7f));
+	x += 10;
+	y += 10;
+
+	// Per-phase average over history
+	double average[PHASE_COUNT] = {};
+	double averageTotal = 0;
+	for (int i = 0; i < frameCount; i++) {
+		for (int p = 0; p < PHASE_COUNT; p++)
+			average[p] += history[i].phases[p] / frameCount;
+		averageTotal += history[i].total / frameCount;
+	}
+
+	double accounted = 0;
+	for (int p = 0; p < PHASE_COUNT; p++) {
+		DrawRectangle(x, y + 4, 10, 10, phaseColors[p]);
+		DrawText(TextFormat("%-16s %6.2f ms", phaseNames[p], 1000 * average[p]), x + 16, y, 20, RAYWHITE);
+		accounted += average[p];
+		y += 20;
+	}
+	DrawText(TextFormat("Other            %6.2f ms", 1000 * std::max(0.0, averageTotal - accounted)), x + 16, y, 20, RAYWHITE);
+	y += 20;
+	DrawText(TextFormat("Frame %.2f ms (%i FPS)", 1000 * averageTotal, GetFPS()), x, y, 20, RAYWHITE);
+	y += 20;
+	DrawText(TextFormat("p50 %.2f  p95 %.2f  p99 %.2f ms", 1000 * FramePercentile(0.5f), 1000 * FramePercentile(0.95f), 1000 * FramePercentile(0.99f)), x, y, 20, RAYWHITE);
+	y += 20;
+
+	// Renderer statistics (last frame)
+	rlFrameStats stats = rlGetFrameStats();
+	DrawText(TextFormat("%i draws  %i vertices  %i KB", stats.drawCalls, stats.vertices, stats.bytesUploaded / 1024), x, y, 20, RAYWHITE);
+	y += 20;
+	DrawText(TextFormat("flush %i: full %i tex %i stack %i state %i", stats.flushes, stats.flushReasons[RL_FLUSH_BUFFER_FULL], stats.flushReasons[RL_FLUSH_TEXTURE_CHANGE], stats.flushReasons[RL_FLUSH_MATRIX_STACK], stats.flushReasons[RL_FLUSH_STATE_CHANGE]), x, y, 20, RAYWHITE);
+	y += 30;
+
+	// Frame time graph: oldest frame on the left, phases stacked
+	DrawRectangleLines(x, y, PROFILER_HISTORY * 2, PROFILER_GRAPH_HEIGHT, DARKGRAY);
+	float scale = PROFILER_GRAPH_HEIGHT / (PROFILER_GRAPH_SCALE_MS / 1000);
+	for (int i = 0; i < frameCount; i++) {
+		const ProfilerFrame &frame = history[(frameIndex - frameCount + i + PROFILER_HISTORY) % PROFILER_HISTORY];
+		int barY = y + PROFILER_GRAPH_HEIGHT;
+		for (int p = 0; p < PHASE_COUNT; p++) {
+			int barHeight = std::min(barY - y, (int) (frame.phases[p] * scale));
+			barY -= barHeight;
+			DrawRectangle(x + i * 2, barY, 2, barHeight, phaseColors[p]);
+		}
+		int totalY = std::max(y, y + PROFILER_GRAPH_HEIGHT - (int) (frame.total * scale));
+		DrawRectangle(x + i * 2, totalY, 2, 1, RAYWHITE);
+	}
+}
+
+#endif
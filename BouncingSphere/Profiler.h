@@ -0,0 +1,54 @@
+#ifndef __PROFILER_H__
+#define __PROFILER_H__
+
+// Frame profiler: per-phase CPU timings with a rolling history and an overlay
+// Define NO_PROFILER (project preprocessor definitions) to compile it out: every PROFILE_* macro then expands to nothing
+
+#if !defined(NO_PROFILER)
+#define PROFILER
+#endif
+
+#define PROFILER_HISTORY 240 // Frames kept in history (4 seconds at 60 FPS)
+
+enum ProfilerPhase {
+	PHASE_INPUT,   // Input & camera
+	PHASE_PHYSICS, // Physics step (MoveBall)
+	PHASE_AUDIO,   // Collision sounds triggering
+	PHASE_DRAW,    // Draw submission
+	PHASE_PRESENT, // EndDrawing: batch flush, swap & frame wait
+	PHASE_COUNT
+};
+
+#if defined(PROFILER)
+
+// Scoped timer: adds the time spent in its scope to the current frame phase
+struct ProfilerScope {
+	ProfilerPhase phase;
+	double start;
+
+	ProfilerScope(ProfilerPhase phase);
+	~ProfilerScope();
+};
+
+void ProfilerNewFrame();
+void ProfilerToggle();
+void DrawProfiler(int x, int y);
+
+#define PROFILER_CONCAT_(a, b) a##b
+#define PROFILER_CONCAT(a, b) PROFILER_CONCAT_(a, b)
+
+#define PROFILE_SCOPE(phase) ProfilerScope PROFILER_CONCAT(profilerScope, __LINE__)(phase)
+#define PROFILE_FRAME() ProfilerNewFrame()
+#define PROFILE_TOGGLE() ProfilerToggle()
+#define PROFILE_DRAW(x, y) DrawProfiler(x, y)
+
+#else
+
+#define PROFILE_SCOPE(phase) ((void) 0)
+#define PROFILE_FRAME() ((void) 0)
+#define PROFILE_TOGGLE() ((void) 0)
+#define PROFILE_DRAW(x, y) ((void) 0)
+
+#endif
+
+#endif
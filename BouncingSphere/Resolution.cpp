@@ -0,0 +1,108 @@
+#include "Resolution.h"
+#include "raymath.h"
+#include "rlgl.h"
+#include <algorithm>
+#include <cmath>
+
+static DynamicResolutionConfig config = DefaultDynamicResolutionConfig(60);
+static RenderTexture2D target = { 0 };
+static bool enabled = false;
+static bool active = false; // Drawing into target
+static float scale = 1;
+static float averageFrameTime = 0;
+static int cooldown = 0;
+
+DynamicResolutionConfig DefaultDynamicResolutionConfig(int targetFPS) {
+	return { 1.0f / targetFPS, 0.5f, 1, 0.75f, 0.95f, 0.9f, 0.05f, 15 };
+}
+
+void SetDynamicResolutionConfig(DynamicResolutionConfig newConfig) {
+	config = newConfig;
+	scale = Clamp(scale, config.minScale, config.maxScale);
+}
+
+DynamicResolutionConfig GetDynamicResolutionConfig() {
+	return config;
+}
+
+void SetDynamicResolution(bool enable) {
+	enabled = enable;
+	averageFrameTime = 0;
+	cooldown = config.cooldownFrames;
+	scale = config.maxScale;
+}
+
+bool IsDynamicResolutionEnabled() {
+	return enabled;
+}
+
+float GetDynamicResolutionScale() {
+	return enabled ? scale : 1;
+}
+
+// Scene cost is assumed proportional to its pixel count (scale squared): scaling down aims at the target directly,
+// scaling up is done step by step until load gets close to the target
+void UpdateDynamicResolution(float frameWorkTime) {
+	if (!enabled || frameWorkTime <= 0)
+		return;
+
+	averageFrameTime = averageFrameTime > 0 ? averageFrameTime * config.smoothing + frameWorkTime * (1 - config.smoothing) : frameWorkTime;
+	if (cooldown > 0) {
+		cooldown--;
+		return;
+	}
+
+	float load = averageFrameTime / config.targetFrameTime;
+	float newScale = scale;
+	if (load > config.highLoad)
+		newScale = std::floor(scale * std::sqrt(config.highLoad / load) / config.step) * config.step;
+	else if (load < config.lowLoad)
+		newScale = scale + config.step;
+	newScale = Clamp(newScale, config.minScale, config.maxScale);
+
+	if (std::fabs(newScale - scale) > config.step / 2) {
+		scale = newScale;
+		averageFrameTime = 0; // Measures at previous scale are not relevant anymore
+		cooldown = config.cooldownFrames;
+	}
+}
+
+void BeginDynamicResolution(Color background) {
+	if (!enabled)
+		return;
+
+	int width = std::max(1, (int) roundf(GetScreenWidth() * scale));
+	int height = std::max(1, (int) roundf(GetScreenHeight() * scale));
+	if (target.texture.width != width || target.texture.height != height) {
+		if (target.id != 0)
+			UnloadRenderTexture(target);
+		target = LoadRenderTexture(width, height);
+		SetTextureFilter(target.texture, FILTER_BILINEAR);
+	}
+
+	BeginTextureMode(target);
+	ClearBackground(background);
+	active = true;
+}
+
+void EndDynamicResolution() {
+	if (!active)
+		return;
+	EndTextureMode();
+	active = false;
+
+	// Render texture is upside down (OpenGL coordinates)
+	// Copied without blending: its alpha channel is not meaningful after transparent objects blending
+	Rectangle source = { 0, 0, (float) target.texture.width, (float) -target.texture.height };
+	Rectangle dest = { 0, 0, (float) GetScreenWidth(), (float) GetScreenHeight() };
+	rlSetBlendMode(0x0001, 0x0000, 0x8006); // GL_ONE, GL_ZERO, GL_FUNC_ADD
+	BeginBlendMode(BLEND_CUSTOM);
+	DrawTexturePro(target.texture, source, dest, { 0, 0 }, 0, WHITE);
+	EndBlendMode();
+}
+
+void UnloadDynamicResolution() {
+	if (target.id != 0)
+		UnloadRenderTexture(target);
+	target = { 0 };
+}
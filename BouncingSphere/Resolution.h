@@ -0,0 +1,32 @@
+#ifndef __RESOLUTION_H__
+#define __RESOLUTION_H__
+#include "raylib.h"
+
+// Dynamic resolution: the 3D scene is rendered into a texture whose size follows the measured frame load, then upscaled
+// to the window; everything drawn after EndDynamicResolution() (UI) keeps the native resolution
+
+struct DynamicResolutionConfig {
+	float targetFrameTime; // Frame work time to hold (seconds)
+	float minScale;        // Scene texture size bounds (fraction of window size)
+	float maxScale;
+	float lowLoad;         // Scale up when average frame time < lowLoad * target
+	float highLoad;        // Scale down when average frame time > highLoad * target
+	float smoothing;       // Frame time exponential moving average factor, in [0, 1[ (0: last frame only)
+	float step;            // Scale granularity: scene texture is not reallocated on every small change
+	int cooldownFrames;    // Minimum frames between two scale changes
+};
+
+DynamicResolutionConfig DefaultDynamicResolutionConfig(int targetFPS);
+void SetDynamicResolutionConfig(DynamicResolutionConfig config);
+DynamicResolutionConfig GetDynamicResolutionConfig();
+
+void SetDynamicResolution(bool enabled);
+bool IsDynamicResolutionEnabled();
+float GetDynamicResolutionScale(); // 1 when disabled
+
+void UpdateDynamicResolution(float frameWorkTime); // Once per frame, GetFrameWorkTime() of previous frame
+void BeginDynamicResolution(Color background);     // Before BeginMode3D()
+void EndDynamicResolution();                       // After EndMode3D(): draws upscaled scene
+void UnloadDynamicResolution();
+
+#endif
@@ -1,4 +1,53 @@
 #include "Utils.h"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+struct FrameArena {
+	char* block = nullptr;
+	size_t capacity = 0;
+	size_t offset = 0; // Beyond capacity, allocations are heap blocks (overflow) freed on reset
+	size_t peak = 0;
+	std::vector<void*> overflow;
+
+	FrameArena();
+	~FrameArena();
+};
+
+static std::mutex arenasMutex;
+static std::vector<FrameArena*> arenas;
+static thread_local FrameArena frameArena;
+static unsigned int randomState = 2463534242u;
+
+#if defined(COUNT_HEAP_ALLOCATIONS)
+static std::atomic<long long> heapAllocations(0);
+
+// Counted heap allocations: every other operator new form ends up here
+void* operator new(size_t size) {
+	heapAllocations++;
+	void* p = malloc(size > 0 ? size : 1);
+	if (p == nullptr)
+		throw std::bad_alloc();
+	return p;
+}
+
+void operator delete(void* p) noexcept {
+	free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+	free(p);
+}
+
+long long GetHeapAllocations() {
+	return heapAllocations;
+}
+#else
+long long GetHeapAllocations() {
+	return -1;
+}
+#endif
 
 template <typename T> int sgn(T val) {
 	return (T(0) < val) - (val < T(0));
@@ -20,3 +69,72 @@ float modulof(float f, float mod) {
 	}
 	return modulof(f - mod, mod);
 }
+
+void seedRandom(unsigned int seed) {
+	randomState = seed != 0 ? seed : 2463534242u; // Xorshift state must not be zero
+}
+
+unsigned int randomBits() {
+	randomState ^= randomState << 13;
+	randomState ^= randomState >> 17;
+	randomState ^= randomState << 5;
+	return randomState;
+}
+
+FrameArena::FrameArena() {
+	std::lock_guard<std::mutex> lock(arenasMutex);
+	arenas.push_back(this);
+}
+
+FrameArena::~FrameArena() {
+	{
+		std::lock_guard<std::mutex> lock(arenasMutex);
+		arenas.erase(std::find(arenas.begin(), arenas.end(), this));
+	}
+	for (void* p : this->overflow)
+		::operator delete(p);
+	::operator delete(this->block);
+}
+
+void* FrameAlloc(size_t size, size_t alignment) {
+	FrameArena& arena = frameArena;
+	if (arena.block == nullptr) {
+		arena.capacity = FRAME_ARENA_SIZE;
+		arena.block = (char*) ::operator new(arena.capacity);
+	}
+
+	size_t start = (arena.offset + alignment - 1) / alignment * alignment;
+	arena.offset = start + size;
+	arena.peak = std::max(arena.peak, arena.offset);
+	if (arena.offset <= arena.capacity)
+		return arena.block + start;
+
+	void* p = ::operator new(size);
+	arena.overflow.push_back(p);
+	return p;
+}
+
+size_t GetFrameArenaMark() {
+	return frameArena.offset;
+}
+
+void SetFrameArenaMark(size_t mark) {
+	FrameArena& arena = frameArena;
+	arena.offset = std::min(arena.offset, mark);
+}
+
+void ResetFrameArenas() {
+	std::lock_guard<std::mutex> lock(arenasMutex);
+	for (FrameArena* arena : arenas) {
+		if (arena->peak > arena->capacity) { // Overflowed during the frame: one block fitting its peak usage
+			for (void* p : arena->overflow)
+				::operator delete(p);
+			arena->overflow.clear();
+			::operator delete(arena->block);
+			arena->capacity = std::max(2 * arena->capacity, arena->peak);
+			arena->block = (char*) ::operator new(arena->capacity);
+		}
+		arena->offset = 0;
+		arena->peak = 0;
+	}
+}
@@ -3,26 +3,87 @@
 
 #include "raylib.h"
 #include "raymath.h"
+#include <cstddef>
 #include <cstdlib>
+#include <new>
+#include <type_traits>
 
 #define EPSILON 1.e-6f
 #define CYLINDER_CAPS_NONE 0
 #define CYLINDER_CAPS_FLAT 1
 #define CYLINDER_CAPS_ROUNDED 2
+#define FRAME_ARENA_SIZE 65536 // Initial size of each thread frame arena (bytes)
 
 template <typename T> int sgn(T val);
 bool approxZero(float val);
 float min(float a, float b);
 float modulof(float f, float mod);
 
+// Pseudo-random numbers (xorshift32), same sequence on every platform for a given seed (game thread only)
+void seedRandom(unsigned int seed);
+unsigned int randomBits();
+
 inline float random() {
-	return rand() / (float) RAND_MAX;
+	return (randomBits() >> 8) / 16777215.0f; // [0, 1]
 }
 
 inline float randPos() {
 	return random() * 2 - 1;
 }
 
+// Frame arena: bump allocator for transient buffers, one per thread (draw threads included)
+// Memory is released at the end of the innermost FrameArenaScope, or by ResetFrameArenas() at the end of each frame
+// (after EndDrawing) and of each physics step. A full arena uses heap blocks until the next reset, then grows to the
+// peak usage of the frame: steady state frames do no heap allocation
+void* FrameAlloc(size_t size, size_t alignment);
+size_t GetFrameArenaMark();
+void SetFrameArenaMark(size_t mark); // Releases allocations made since mark (calling thread)
+void ResetFrameArenas(); // Every thread arena: no FrameAlloc() may run meanwhile (draw threads idle)
+
+// Releases allocations made in its scope (calling thread arena)
+struct FrameArenaScope {
+	size_t mark;
+
+	FrameArenaScope() : mark(GetFrameArenaMark()) {}
+	~FrameArenaScope() {
+		SetFrameArenaMark(this->mark);
+	}
+};
+
+// Value-initialized items allocated in the calling thread arena (never destroyed: trivially destructible types only)
+template <typename T> struct FrameArray {
+	T* items;
+	size_t count;
+
+	T& operator[](size_t i) {
+		return this->items[i];
+	}
+
+	size_t size() const {
+		return this->count;
+	}
+
+	T* begin() {
+		return this->items;
+	}
+
+	T* end() {
+		return this->items + this->count;
+	}
+};
+
+template <typename T> FrameArray<T> FrameAllocArray(size_t count) {
+	static_assert(std::is_trivially_destructible<T>::value, "Frame arena items are never destroyed");
+	T* items = (T*) FrameAlloc(count * sizeof(T), alignof(T));
+	for (size_t i = 0; i < count; i++)
+		new (items + i) T();
+	return { items, count };
+}
+
+// Heap allocations (global operator new) since program start, for steady state checks
+// NOTE: Only counted when built with COUNT_HEAP_ALLOCATIONS (debug configurations), -1 otherwise
+long long GetHeapAllocations();
+
 // Add
 inline Vector3 operator+(Vector3 v1, Vector3 v2) {
 	return Vector3Add(v1, v2);
@@ -0,0 +1,57 @@
+#version 330
+
+// Sphere impostor: exact ray-sphere intersection, depth write and latitude/longitude wires
+
+#define PI 3.14159265358979
+#define SEGMENTS_THETA 20.0
+#define SEGMENTS_PHI 20.0
+
+// Input vertex attributes (from vertex shader)
+in vec3 fragPosition;
+flat in vec3 fragCenter;
+flat in float fragRadius;
+flat in vec4 fragRotation;
+flat in vec4 fragColor;
+
+// Input uniform values
+uniform mat4 mvp;
+uniform vec3 viewPos;
+uniform vec4 wireColor;
+
+// Output fragment color
+out vec4 finalColor;
+
+// Rotate vector by quaternion
+vec3 rotate(vec4 q, vec3 v)
+{
+    return v + 2.0*cross(q.xyz, cross(q.xyz, v) + q.w*v);
+}
+
+// Distance to closest grid line (in pixels) for a grid coordinate
+float gridLine(float coord)
+{
+    float cell = abs(fract(coord + 0.5) - 0.5);
+    return cell/max(fwidth(coord), 1e-5);
+}
+
+void main()
+{
+    vec3 dir = normalize(fragPosition - viewPos);
+    vec3 oc = viewPos - fragCenter;
+    float b = dot(dir, oc);
+    float h = b*b - dot(oc, oc) + fragRadius*fragRadius;
+    if (h < 0.0) discard;
+
+    vec3 hit = viewPos + dir*(-b - sqrt(h));
+
+    vec4 clip = mvp*vec4(hit, 1.0);
+    gl_FragDepth = 0.5*(clip.z/clip.w) + 0.5;
+
+    // Local spherical coordinates (same convention as Spherical::toCartesian(), Y up)
+    vec3 local = rotate(vec4(-fragRotation.xyz, fragRotation.w), (hit - fragCenter)/fragRadius);
+    float phi = acos(clamp(local.y, -1.0, 1.0));
+    float theta = atan(local.z, local.x);
+
+    float line = min(gridLine(theta*SEGMENTS_THETA/(2.0*PI)), gridLine(phi*SEGMENTS_PHI/PI));
+    finalColor = mix(wireColor, fragColor, smoothstep(0.5, 1.0, line));
+}
@@ -0,0 +1,44 @@
+#version 330
+
+// Sphere impostor: camera-facing quad enclosing the sphere silhouette
+
+// Input vertex attributes
+in vec3 vertexPosition;     // Sphere center
+in vec2 vertexTexCoord;     // Quad corner (-1..1)
+in vec2 vertexTexCoord2;    // Sphere radius (x)
+in vec4 vertexTangent;      // Sphere rotation quaternion
+in vec4 vertexColor;        // Sphere color
+
+// Input uniform values
+uniform mat4 mvp;
+uniform mat4 view;
+uniform vec3 viewPos;
+
+// Output vertex attributes (to fragment shader)
+out vec3 fragPosition;
+flat out vec3 fragCenter;
+flat out float fragRadius;
+flat out vec4 fragRotation;
+flat out vec4 fragColor;
+
+void main()
+{
+    vec3 toCamera = viewPos - vertexPosition;
+    float dist = length(toCamera);
+    vec3 forward = toCamera/dist;
+    vec3 cameraUp = vec3(view[0][1], view[1][1], view[2][1]);
+    vec3 right = normalize(cross(cameraUp, forward));
+    vec3 up = cross(forward, right);
+
+    // Silhouette cone section at sphere center: r*d/sqrt(d^2 - r^2)
+    float radius = vertexTexCoord2.x;
+    float size = radius*dist/sqrt(max(dist*dist - radius*radius, 1e-4));
+
+    fragPosition = vertexPosition + (right*vertexTexCoord.x + up*vertexTexCoord.y)*size;
+    fragCenter = vertexPosition;
+    fragRadius = radius;
+    fragRotation = vertexTangent;
+    fragColor = vertexColor;
+
+    gl_Position = mvp*vec4(fragPosition, 1.0);
+}
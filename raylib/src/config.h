@@ -75,6 +75,11 @@
 #define MAX_TOUCH_POINTS              10        // Maximum number of touch points supported
 #define MAX_KEY_PRESSED_QUEUE         16        // Max number of characters in the key input queue
 
+#define MAX_SCREENSHOT_SLOTS           4        // Max async screenshots in flight (pixel buffers pool size)
+#define MAX_RECORDING_PIXEL_BUFFERS    3        // Max pixel buffers used for async screen recording readback
+#define MAX_RECORDING_QUEUE_FRAMES     8        // Max screen recording frames waiting to be encoded (new frames dropped when full)
+#define MAX_ASSET_PACK_FILES         512        // Max files packed by ExportAssetPack()
+
 #define STORAGE_DATA_FILE  "storage.data"       // Automatic storage filename
 
 
@@ -146,6 +151,14 @@
 // Support multiple image editing functions to scale, adjust colors, flip, draw on images, crop...
 // If not defined, still some functions are supported: ImageFormat(), ImageCrop(), ImageToPOT()
 #define SUPPORT_IMAGE_MANIPULATION  1
+// Support ImageFormat() fast paths for common conversions, SIMD accelerated (SSE2/SSSE3/AVX2) if enabled by compiler
+#define SUPPORT_IMAGE_FORMAT_FAST   1
+// Support multi-threaded ImageResize() and ImageMipmaps(), image split in row strips processed in parallel
+#define SUPPORT_IMAGE_PARALLEL      1
+// Minimum output pixels to split image processing between threads, smaller images are processed on calling thread
+#define MAX_IMAGE_PARALLEL_MIN_PIXELS  65536
+// Support ImageFormat() conversion to DXT compressed formats (CPU encoder, SIMD and multi-threaded) and DDS export
+#define SUPPORT_IMAGE_COMPRESSION   1
 
 
 //------------------------------------------------------------------------------------
@@ -157,6 +170,8 @@
 // Selected desired font fileformats to be supported for loading
 #define SUPPORT_FILEFORMAT_FNT      1
 #define SUPPORT_FILEFORMAT_TTF      1
+// Support multi-threaded TTF glyphs rasterization on font loading (LoadFontData())
+#define SUPPORT_FONT_PARALLEL       1
 
 // Support text management functions
 // If not defined, still some functions are supported: TextLength(), TextFormat()
@@ -168,6 +183,10 @@
                                                 // TextFormat(), TextSubtext(), TextToUpper(), TextToLower(), TextToPascal(), TextSplit()
 #define MAX_TEXT_UNICODE_CHARS       512        // Maximum number of unicode codepoints: GetCodepoints()
 #define MAX_TEXTSPLIT_COUNT          128        // Maximum number of substrings to split: TextSplit()
+#define MAX_TEXT_LAYOUT_BATCH_QUADS 1024        // Maximum number of glyph quads sent at once: DrawTextLayout()
+#define MAX_FONT_PARALLEL_MIN_GLYPHS  32        // Minimum glyphs count to rasterize on multiple threads: LoadFontData()
+#define MAX_FONT_DYNAMIC_GLYPHS     4096        // Maximum number of glyphs loaded by a dynamic font: LoadFontDynamic()
+#define MAX_FONT_DYNAMIC_ATLAS_SIZE 4096        // Maximum dynamic font atlas texture height: LoadFontDynamic()
 
 
 //------------------------------------------------------------------------------------
@@ -193,6 +212,12 @@
 //#define SUPPORT_FILEFORMAT_MOD      1
 #define SUPPORT_FILEFORMAT_MP3      1
 //#define SUPPORT_FILEFORMAT_FLAC     1
+// Support SIMD accelerated audio mixing (SSE/AVX/NEON) if enabled by compiler, scalar code otherwise
+#define SUPPORT_AUDIO_MIXING_SIMD   1
+// Support NEON audio mixing kernels (not checked against scalar code yet)
+//#define SUPPORT_AUDIO_MIXING_NEON   1
+// Support decoding music ahead on a background thread (StartMusicDecoder()), no UpdateMusicStream() required
+#define SUPPORT_MUSIC_DECODER_THREAD 1
 
 // audio: Configuration values
 //------------------------------------------------------------------------------------
@@ -201,7 +226,8 @@
 #define AUDIO_DEVICE_SAMPLE_RATE       44100    // Device output sample rate
 
 #define DEFAULT_AUDIO_BUFFER_SIZE       4096    // Default audio buffer size for streaming
-#define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Maximum number of audio pool channels
+#define MAX_AUDIO_BUFFER_POOL_CHANNELS    32    // Maximum number of audio pool channels (sounds played at the same time)
+#define MAX_AUDIO_COMMANDS              1024    // Maximum audio commands queued between two mixings (power of two)
 
 //------------------------------------------------------------------------------------
 // Module: utils - Configuration Flags
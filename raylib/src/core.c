@@ -5,6 +5,7 @@
 *   PLATFORMS SUPPORTED:
 *       - PLATFORM_DESKTOP: Windows (Win32, Win64)
 *       - PLATFORM_DESKTOP: Linux (X11 desktop mode)
+*       - PLATFORM_DESKTOP: Linux headless (OSMesa offscreen context, no display required)
 *       - PLATFORM_DESKTOP: FreeBSD, OpenBSD, NetBSD, DragonFly (X11 desktop)
 *       - PLATFORM_DESKTOP: OSX/macOS
 *       - PLATFORM_ANDROID: Android 4.0 (ARM, ARM64)
@@ -19,6 +20,11 @@
 *       Windowing and input system configured for desktop platforms: Windows, Linux, OSX, FreeBSD, OpenBSD, NetBSD, DragonFly
 *       NOTE: Oculus Rift CV1 requires PLATFORM_DESKTOP for mirror rendering - View [rlgl] module to enable it
 *
+*   #define _GLFW_OSMESA (PLATFORM_DESKTOP, Linux only)
+*       No window system used, OpenGL context is created offscreen by OSMesa (software rendering) with a
+*       fixed-size framebuffer, useful to render and capture frames on display-less machines (benchmarks, CI)
+*       NOTE: OSMesa library (libOSMesa.so) is loaded at runtime by GLFW, window state changes are ignored
+*
 *   #define PLATFORM_ANDROID
 *       Windowing and input system configured for Android device, app activity managed internally in this module.
 *       NOTE: OpenGL ES 2.0 is required and graphic device is managed by EGL
@@ -70,9 +76,12 @@
 *
 *   #define SUPPORT_SCREEN_CAPTURE
 *       Allow automatic screen capture of current screen pressing F12, defined in KeyCallback()
+*       Screenshot is encoded and saved on a background thread (see TakeScreenshotAsync())
 *
 *   #define SUPPORT_GIF_RECORDING
 *       Allow automatic gif recording of current screen pressing CTRL+F12, defined in KeyCallback()
+*       Frames are read back asynchronously (pixel buffers ring) and encoded on a background thread,
+*       frames not fitting the encoder queue are dropped (see GetScreenRecordingDroppedFrames())
 *
 *   #define SUPPORT_COMPRESSION_API
 *       Support CompressData() and DecompressData() functions, those functions use zlib implementation
@@ -268,6 +277,15 @@
     char *stbi_zlib_decode_malloc(char const *buffer, int len, int *outlen);
 #endif
 
+#if defined(SUPPORT_IMAGE_EXPORT)
+    // NOTE: Those declarations require stb_image_write definitions, included in textures module
+    // Async screenshots call image writers directly, ExportImage() is not thread safe (see SaveScreenshotSlot())
+    int stbi_write_png(char const *filename, int w, int h, int comp, const void *data, int stride_in_bytes);
+    int stbi_write_bmp(char const *filename, int w, int h, int comp, const void *data);
+    int stbi_write_tga(char const *filename, int w, int h, int comp, const void *data);
+    int stbi_write_jpg(char const *filename, int w, int h, int comp, const void *data, int quality);
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -305,6 +323,20 @@
     #define MAX_CHAR_PRESSED_QUEUE        16        // Max number of characters in the char input queue
 #endif
 
+#if defined(SUPPORT_GIF_RECORDING)
+    #ifndef MAX_RECORDING_PIXEL_BUFFERS
+        #define MAX_RECORDING_PIXEL_BUFFERS    3    // Max pixel buffers used for async frames readback
+    #endif
+    #ifndef MAX_RECORDING_QUEUE_FRAMES
+        #define MAX_RECORDING_QUEUE_FRAMES     8    // Max frames waiting to be encoded (pooled frame buffers), new frames are dropped when full
+    #endif
+    #define GIF_RECORD_FRAMERATE              10    // Record one gif frame every 10 game frames
+#endif
+
+#ifndef MAX_SCREENSHOT_SLOTS
+    #define MAX_SCREENSHOT_SLOTS           4        // Max async screenshots in flight (pixel buffers pool size)
+#endif
+
 #if defined(SUPPORT_DATA_STORAGE)
     #ifndef STORAGE_DATA_FILE
         #define STORAGE_DATA_FILE  "storage.data"   // Automatic storage filename
@@ -467,6 +499,7 @@ typedef struct CoreData {
         double update;                      // Time measure for frame update
         double draw;                        // Time measure for frame draw
         double frame;                       // Time measure for one frame
+        double work;                        // Time measure for one frame, FPS limiter wait excluded
         double target;                      // Desired time for one frame, if 0 not applied
 #if defined(PLATFORM_ANDROID) || defined(PLATFORM_RPI) || defined(PLATFORM_DRM) || defined(PLATFORM_UWP)
         unsigned long long base;            // Base time measure for hi-res timer
@@ -486,10 +519,70 @@ static int dirFilesCount = 0;               // Count directory files strings
 static int screenshotCounter = 0;           // Screenshots counter
 #endif
 
+// Async screenshot slot state
+typedef enum {
+    SCREENSHOT_SLOT_FREE = 0,               // Slot available, pixels buffer kept for reuse
+    SCREENSHOT_SLOT_BUSY,                   // Screenshot being encoded and saved by worker
+    SCREENSHOT_SLOT_DONE                    // Screenshot saved, completion not reported yet
+} ScreenshotSlotState;
+
+// Async screenshot file format, chosen on main thread from file extension
+typedef enum {
+    SCREENSHOT_FILE_PNG = 0,
+    SCREENSHOT_FILE_BMP,
+    SCREENSHOT_FILE_TGA,
+    SCREENSHOT_FILE_JPG,
+    SCREENSHOT_FILE_RAW
+} ScreenshotFileType;
+
+// Async screenshot slot
+typedef struct ScreenshotSlot {
+    int state;                              // Slot state (ScreenshotSlotState), protected by screenshots.lock
+    bool success;                           // Screenshot saved successfully
+    unsigned char *pixels;                  // Pooled pixels buffer (RGBA)
+    int capacity;                           // Pixels buffer size in bytes
+    int width;                              // Screenshot width
+    int height;                             // Screenshot height
+    int fileType;                           // Screenshot file format (ScreenshotFileType)
+    char path[512];                         // Screenshot file path
+} ScreenshotSlot;
+
+// Async screenshots state
+static struct {
+    ScreenshotSlot slots[MAX_SCREENSHOT_SLOTS];  // Screenshot slots pool
+    JobQueue *worker;                       // Encoder thread queue (loaded on first use)
+    Mutex *lock;                            // Slots state lock
+    ScreenshotCallback callback;            // Completion callback (called on main thread)
+} screenshots = { 0 };
+
 #if defined(SUPPORT_GIF_RECORDING)
-static int gifFramesCounter = 0;            // GIF frames counter
-static bool gifRecording = false;           // GIF recording state
-static MsfGifState gifState = { 0 };        // MSGIF context state
+// Screen recording frame, queued for encoding
+typedef struct RecordingFrame {
+    unsigned char *pixels;                  // Pooled frame pixels buffer (RGBA), allocated on recording start
+    bool bottomUp;                          // Frame rows are stored bottom-up (framebuffer order)
+    bool busy;                              // Frame waiting for encoder or being encoded, protected by recording.lock
+} RecordingFrame;
+
+// Screen recording state
+static struct {
+    bool active;                            // Recording state
+    bool rawVideo;                          // Recording raw video (YUV4MPEG2) instead of GIF
+    char fileName[512];                     // Recording output file path
+    int width;                              // Recording frame width
+    int height;                             // Recording frame height
+    int framesCounter;                      // Game frames counter since recording start
+    int framesEncoded;                      // Frames sent to encoder
+    int framesDropped;                      // Frames dropped (encoder queue full or readback failed)
+    unsigned int pixelBuffers[MAX_RECORDING_PIXEL_BUFFERS];  // Pixel buffers ring for async readback
+    int pixelBuffersHead;                   // Next pixel buffer to read into
+    int pixelBuffersPending;                // Pixel buffers with a readback in flight
+    JobQueue *encoder;                      // Encoder thread queue
+    RecordingFrame frames[MAX_RECORDING_QUEUE_FRAMES];  // Frames pool, returned by encoder thread
+    Mutex *lock;                            // Frames pool state lock
+    MsfGifState gifState;                   // MSGIF context state
+    FILE *rawFile;                          // Raw video output file
+    unsigned char *rawPlanes;               // Raw video YUV planes (encoder thread only)
+} recording = { 0 };
 #endif
 //-----------------------------------------------------------------------------------
 
@@ -509,6 +602,18 @@ static void SetupFramebuffer(int width, int height);    // Setup main framebuffe
 static void SetupViewport(int width, int height);       // Set viewport for a provided width and height
 static void SwapBuffers(void);                          // Copy back buffer to front buffers
 
+static void SaveScreenshotSlot(void *data);             // Encode and save screenshot slot (runs on worker thread)
+static void PollScreenshots(void);                      // Report finished async screenshots, free their slots
+
+#if defined(SUPPORT_GIF_RECORDING)
+static void CaptureRecordingFrame(void);                // Queue current frame readback for screen recording
+static void CollectRecordingFrame(void);                // Collect oldest frame readback and send it to encoder
+static RecordingFrame *AcquireRecordingFrame(void);     // Take a free frame from pool, NULL if every frame is busy
+static void ReleaseRecordingFrame(RecordingFrame *frame); // Return frame to pool
+static void QueueRecordingFrame(RecordingFrame *frame); // Send frame to encoder thread, drop it if queue is full
+static void EncodeRecordingFrame(void *data);           // Encode recording frame (runs on encoder thread)
+#endif
+
 static void InitTimer(void);                            // Initialize timer
 static void Wait(float ms);                             // Wait for some milliseconds (stop program execution)
 
@@ -799,13 +904,19 @@ void InitWindow(int width, int height, const char *title)
 void CloseWindow(void)
 {
 #if defined(SUPPORT_GIF_RECORDING)
-    if (gifRecording)
+    if (recording.active) EndScreenRecording();
+#endif
+
+    // Wait for async screenshots to be saved
+    if (screenshots.worker != NULL)
     {
-        MsfGifResult result = msf_gif_end(&gifState);
-        msf_gif_free(result);
-        gifRecording = false;
+        UnloadJobQueue(screenshots.worker);
+        PollScreenshots();
+        UnloadMutex(screenshots.lock);
+
+        for (int i = 0; i < MAX_SCREENSHOT_SLOTS; i++) RL_FREE(screenshots.slots[i].pixels);
+        memset(&screenshots, 0, sizeof(screenshots));
     }
-#endif
 
 #if defined(SUPPORT_DEFAULT_FONT)
     UnloadFontDefault();
@@ -1009,6 +1120,16 @@ bool IsWindowResized(void)
 #endif
 }
 
+// Check if window is rendering offscreen, without display (headless OSMesa context)
+bool IsWindowHeadless(void)
+{
+#if defined(PLATFORM_DESKTOP) && defined(_GLFW_OSMESA)
+    return true;
+#else
+    return false;
+#endif
+}
+
 // Check if one specific window flag is enabled
 bool IsWindowState(unsigned int flag)
 {
@@ -1018,7 +1139,9 @@ bool IsWindowState(unsigned int flag)
 // Toggle fullscreen mode (only PLATFORM_DESKTOP)
 void ToggleFullscreen(void)
 {
-#if defined(PLATFORM_DESKTOP)
+#if defined(PLATFORM_DESKTOP) && defined(_GLFW_OSMESA)
+    TRACELOG(LOG_WARNING, "SYSTEM: Fullscreen not supported on headless mode");
+#elif defined(PLATFORM_DESKTOP)
     // NOTE: glfwSetWindowMonitor() doesn't work properly (bugs)
     if (!CORE.Window.fullscreen)
     {
@@ -1787,24 +1910,14 @@ void EndDrawing(void)
     rlglDraw();                     // Draw Buffers (Only OpenGL 3+ and ES2)
 
 #if defined(SUPPORT_GIF_RECORDING)
-    #define GIF_RECORD_FRAMERATE    10
-
-    if (gifRecording)
+    if (recording.active)
     {
-        gifFramesCounter++;
-
-        // NOTE: We record one gif frame every 10 game frames
-        if ((gifFramesCounter%GIF_RECORD_FRAMERATE) == 0)
-        {
-            // Get image data for the current frame (from backbuffer)
-            // NOTE: This process is quite slow... :(
-            unsigned char *screenData = rlReadScreenPixels(CORE.Window.screen.width, CORE.Window.screen.height);
-            msf_gif_frame(&gifState, screenData, 10, 16, CORE.Window.screen.width*4);
+        recording.framesCounter++;
 
-            RL_FREE(screenData);   // Free image data
-        }
+        // NOTE: We record one gif frame every 10 game frames, raw video records every frame
+        if (recording.rawVideo || ((recording.framesCounter%GIF_RECORD_FRAMERATE) == 0)) CaptureRecordingFrame();
 
-        if (((gifFramesCounter/15)%2) == 1)
+        if (((recording.framesCounter/15)%2) == 1)
         {
             DrawCircle(30, CORE.Window.screen.height - 20, 10, RED);
             DrawText("RECORDING", 50, CORE.Window.screen.height - 25, 10, MAROON);
@@ -1815,7 +1928,9 @@ void EndDrawing(void)
 #endif
 
     SwapBuffers();                  // Copy back buffer to front buffer
+    rlResetFrameStats();            // Close frame statistics (rlGetFrameStats())
     PollInputEvents();              // Poll user events
+    PollScreenshots();              // Report finished async screenshots
 
     // Frame time control system
     CORE.Time.current = GetTime();
@@ -1823,6 +1938,7 @@ void EndDrawing(void)
     CORE.Time.previous = CORE.Time.current;
 
     CORE.Time.frame = CORE.Time.update + CORE.Time.draw;
+    CORE.Time.work = CORE.Time.frame;
 
     // Wait for some milliseconds...
     if (CORE.Time.frame < CORE.Time.target)
@@ -2175,6 +2291,13 @@ float GetFrameTime(void)
     return (float)CORE.Time.frame;
 }
 
+// Returns time in seconds for last frame update and draw (SetTargetFPS() wait excluded)
+// NOTE: Useful to measure the load of a frame limited by target FPS
+float GetFrameWorkTime(void)
+{
+    return (float)CORE.Time.work;
+}
+
 // Get elapsed time measure in seconds since InitTimer()
 // NOTE: On PLATFORM_DESKTOP InitTimer() is called on InitWindow()
 // NOTE: On PLATFORM_DESKTOP, timer is initialized on glfwInit()
@@ -2244,6 +2367,251 @@ void TakeScreenshot(const char *fileName)
     TRACELOG(LOG_INFO, "SYSTEM: [%s] Screenshot taken successfully", path);
 }
 
+// Takes a screenshot of current screen, encoding and saving is done on a background thread
+// NOTE: Returns false if all screenshot slots are busy, completion is reported by callback (see SetScreenshotCallback())
+bool TakeScreenshotAsync(const char *fileName)
+{
+    // NOTE: File format is chosen here, IsFileExtension() uses text static buffers not safe to use on worker thread
+    int fileType = -1;
+#if defined(SUPPORT_IMAGE_EXPORT)
+#if defined(SUPPORT_FILEFORMAT_PNG)
+    if (IsFileExtension(fileName, ".png")) fileType = SCREENSHOT_FILE_PNG;
+#endif
+#if defined(SUPPORT_FILEFORMAT_BMP)
+    if (IsFileExtension(fileName, ".bmp")) fileType = SCREENSHOT_FILE_BMP;
+#endif
+#if defined(SUPPORT_FILEFORMAT_TGA)
+    if (IsFileExtension(fileName, ".tga")) fileType = SCREENSHOT_FILE_TGA;
+#endif
+#if defined(SUPPORT_FILEFORMAT_JPG)
+    if (IsFileExtension(fileName, ".jpg")) fileType = SCREENSHOT_FILE_JPG;
+#endif
+    if (IsFileExtension(fileName, ".raw")) fileType = SCREENSHOT_FILE_RAW;
+#endif
+    if (fileType == -1)
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: [%s] Screenshot file format not supported", fileName);
+        return false;
+    }
+
+    if (screenshots.worker == NULL)
+    {
+        screenshots.lock = LoadMutex();
+        screenshots.worker = LoadJobQueue(1, MAX_SCREENSHOT_SLOTS);
+    }
+
+    ScreenshotSlot *slot = NULL;
+
+    LockMutex(screenshots.lock);
+    for (int i = 0; i < MAX_SCREENSHOT_SLOTS; i++)
+    {
+        if (screenshots.slots[i].state == SCREENSHOT_SLOT_FREE)
+        {
+            slot = &screenshots.slots[i];
+            slot->state = SCREENSHOT_SLOT_BUSY;
+            break;
+        }
+    }
+    UnlockMutex(screenshots.lock);
+
+    if (slot == NULL)
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: [%s] Screenshot skipped, too many screenshots in flight", fileName);
+        return false;
+    }
+
+    slot->width = CORE.Window.render.width;
+    slot->height = CORE.Window.render.height;
+    slot->fileType = fileType;
+
+    // Reuse pooled pixels buffer, only grow it when required
+    int size = slot->width*slot->height*4;
+    if (slot->capacity < size)
+    {
+        RL_FREE(slot->pixels);
+        slot->pixels = (unsigned char *)RL_MALLOC(size);
+        slot->capacity = size;
+    }
+
+    rlCopyScreenPixels(slot->pixels, slot->width, slot->height);
+
+#if defined(PLATFORM_ANDROID)
+    strcpy(slot->path, CORE.Android.internalDataPath);
+    strcat(slot->path, "/");
+    strcat(slot->path, fileName);
+#elif defined(PLATFORM_UWP)
+    strcpy(slot->path, CORE.UWP.internalDataPath);
+    strcat(slot->path, "/");
+    strcat(slot->path, fileName);
+#else
+    strcpy(slot->path, fileName);
+#endif
+
+    // NOTE: Queue capacity matches slots count, push never fails
+    PushJob(screenshots.worker, SaveScreenshotSlot, slot);
+
+    return true;
+}
+
+// Set async screenshots completion callback
+void SetScreenshotCallback(ScreenshotCallback callback)
+{
+    screenshots.callback = callback;
+}
+
+// Get number of async screenshots not saved yet
+int GetScreenshotsPending(void)
+{
+    int pending = 0;
+
+    if (screenshots.lock == NULL) return 0;
+
+    LockMutex(screenshots.lock);
+    for (int i = 0; i < MAX_SCREENSHOT_SLOTS; i++) if (screenshots.slots[i].state == SCREENSHOT_SLOT_BUSY) pending++;
+    UnlockMutex(screenshots.lock);
+
+    return pending;
+}
+
+// Begin screen recording (.gif or .y4m raw video)
+// NOTE: Frames are read back asynchronously and encoded on a background thread
+void BeginScreenRecording(const char *fileName)
+{
+#if defined(SUPPORT_GIF_RECORDING)
+    if (recording.active) EndScreenRecording();
+
+#if defined(PLATFORM_ANDROID)
+    strcpy(recording.fileName, CORE.Android.internalDataPath);
+    strcat(recording.fileName, "/");
+    strcat(recording.fileName, fileName);
+#elif defined(PLATFORM_UWP)
+    strcpy(recording.fileName, CORE.UWP.internalDataPath);
+    strcat(recording.fileName, "/");
+    strcat(recording.fileName, fileName);
+#else
+    strcpy(recording.fileName, fileName);
+#endif
+
+    recording.rawVideo = IsFileExtension(fileName, ".y4m");
+    recording.width = CORE.Window.screen.width;
+    recording.height = CORE.Window.screen.height;
+    recording.framesCounter = 0;
+    recording.framesEncoded = 0;
+    recording.framesDropped = 0;
+    recording.pixelBuffersHead = 0;
+    recording.pixelBuffersPending = 0;
+
+    if (recording.rawVideo)
+    {
+        recording.rawFile = fopen(recording.fileName, "wb");
+
+        if (recording.rawFile == NULL)
+        {
+            TRACELOG(LOG_WARNING, "SYSTEM: [%s] Failed to open file for screen recording", recording.fileName);
+            return;
+        }
+
+        // NOTE: Frame rate is taken from target FPS, 60 fps considered if not set
+        int fps = (CORE.Time.target > 0.0)? (int)(1.0/CORE.Time.target + 0.5) : 60;
+        fprintf(recording.rawFile, "YUV4MPEG2 W%i H%i F%i:1 Ip A1:1 C444\n", recording.width, recording.height, fps);
+        recording.rawPlanes = (unsigned char *)RL_MALLOC(recording.width*recording.height*3);
+    }
+    else msf_gif_begin(&recording.gifState, recording.width, recording.height);
+
+    for (int i = 0; i < MAX_RECORDING_PIXEL_BUFFERS; i++) recording.pixelBuffers[i] = rlLoadPixelBuffer(recording.width*recording.height*4);
+
+    if (recording.pixelBuffers[0] == 0) TRACELOG(LOG_INFO, "SYSTEM: Pixel buffers not supported, screen recording uses synchronous readback");
+
+    // NOTE: Frame buffers are allocated once, no full frame allocation while recording
+    for (int i = 0; i < MAX_RECORDING_QUEUE_FRAMES; i++)
+    {
+        recording.frames[i].pixels = (unsigned char *)RL_MALLOC(recording.width*recording.height*4);
+        recording.frames[i].busy = false;
+    }
+
+    recording.lock = LoadMutex();
+    recording.encoder = LoadJobQueue(1, MAX_RECORDING_QUEUE_FRAMES);
+    recording.active = true;
+
+    TRACELOG(LOG_INFO, "SYSTEM: Start screen recording: %s", recording.fileName);
+#else
+    TRACELOG(LOG_WARNING, "SYSTEM: Screen recording not supported (SUPPORT_GIF_RECORDING)");
+#endif
+}
+
+// End screen recording, waits for pending frames to be encoded and saves file
+void EndScreenRecording(void)
+{
+#if defined(SUPPORT_GIF_RECORDING)
+    if (!recording.active) return;
+
+    // Collect in-flight readbacks and wait for encoder
+    while (recording.pixelBuffersPending > 0) CollectRecordingFrame();
+
+    UnloadJobQueue(recording.encoder);
+    recording.encoder = NULL;
+
+    for (int i = 0; i < MAX_RECORDING_QUEUE_FRAMES; i++)
+    {
+        RL_FREE(recording.frames[i].pixels);
+        recording.frames[i].pixels = NULL;
+    }
+
+    UnloadMutex(recording.lock);
+    recording.lock = NULL;
+
+    for (int i = 0; i < MAX_RECORDING_PIXEL_BUFFERS; i++)
+    {
+        rlUnloadPixelBuffer(recording.pixelBuffers[i]);
+        recording.pixelBuffers[i] = 0;
+    }
+
+    if (recording.rawVideo)
+    {
+        fclose(recording.rawFile);
+        recording.rawFile = NULL;
+        RL_FREE(recording.rawPlanes);
+        recording.rawPlanes = NULL;
+    }
+    else
+    {
+        MsfGifResult result = msf_gif_end(&recording.gifState);
+        SaveFileData(recording.fileName, result.data, (unsigned int)result.dataSize);
+        msf_gif_free(result);
+    }
+
+    recording.active = false;
+
+#if defined(PLATFORM_WEB)
+    // Download file from MEMFS (emscripten memory filesystem)
+    // saveFileFromMEMFSToDisk() function is defined in raylib/templates/web_shel/shell.html
+    emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", GetFileName(recording.fileName), GetFileName(recording.fileName)));
+#endif
+
+    TRACELOG(LOG_INFO, "SYSTEM: Finish screen recording: %s (%i frames, %i dropped)", recording.fileName, recording.framesEncoded, recording.framesDropped);
+#endif
+}
+
+// Check if screen is being recorded
+bool IsScreenRecording(void)
+{
+#if defined(SUPPORT_GIF_RECORDING)
+    return recording.active;
+#else
+    return false;
+#endif
+}
+
+// Get number of frames dropped by current (or last) screen recording
+int GetScreenRecordingDroppedFrames(void)
+{
+#if defined(SUPPORT_GIF_RECORDING)
+    return recording.framesDropped;
+#else
+    return 0;
+#endif
+}
+
 // Returns a random value between min and max (both included)
 int GetRandomValue(int min, int max)
 {
@@ -3201,6 +3569,15 @@ static bool InitGraphicsDevice(int width, int height)
     //glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_API); // OpenGL API to use. Alternative: GLFW_OPENGL_ES_API
     //glfwWindowHint(GLFW_AUX_BUFFERS, 0);          // Number of auxiliar buffers
 
+#if defined(PLATFORM_DESKTOP) && defined(_GLFW_OSMESA)
+    // Headless mode: framebuffer is rendered offscreen by OSMesa, with a fixed size
+    // NOTE: Null window system is used, so window visibility and size flags have no meaning
+    glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+    CORE.Window.flags |= FLAG_WINDOW_HIDDEN;
+    CORE.Window.flags &= ~(FLAG_FULLSCREEN_MODE | FLAG_WINDOW_RESIZABLE | FLAG_VSYNC_HINT);
+    TRACELOG(LOG_INFO, "DISPLAY: Headless mode, OSMesa offscreen context (%i x %i)", CORE.Window.screen.width, CORE.Window.screen.height);
+#endif
+
     // Check window creation flags
     if ((CORE.Window.flags & FLAG_FULLSCREEN_MODE) > 0) CORE.Window.fullscreen = true;
 
@@ -4470,6 +4847,229 @@ static void PollInputEvents(void)
 #endif
 }
 
+// Encode and save screenshot slot (runs on worker thread)
+static void SaveScreenshotSlot(void *data)
+{
+    ScreenshotSlot *slot = (ScreenshotSlot *)data;
+    int pitch = slot->width*4;
+
+    // Flip image vertically in place and set alpha component value to 255
+    // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
+    for (int y = 0; y < slot->height/2; y++)
+    {
+        unsigned char *top = slot->pixels + y*pitch;
+        unsigned char *bottom = slot->pixels + (slot->height - 1 - y)*pitch;
+
+        for (int x = 0; x < pitch; x++)
+        {
+            unsigned char temp = top[x];
+            top[x] = bottom[x];
+            bottom[x] = temp;
+        }
+    }
+
+    for (int i = 3; i < slot->height*pitch; i += 4) slot->pixels[i] = 255;
+
+    // NOTE: Image writers called directly, ExportImage() checks file extension using text static buffers
+    bool success = false;
+#if defined(SUPPORT_IMAGE_EXPORT)
+    switch (slot->fileType)
+    {
+    #if defined(SUPPORT_FILEFORMAT_PNG)
+        case SCREENSHOT_FILE_PNG: success = stbi_write_png(slot->path, slot->width, slot->height, 4, slot->pixels, pitch); break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_BMP)
+        case SCREENSHOT_FILE_BMP: success = stbi_write_bmp(slot->path, slot->width, slot->height, 4, slot->pixels); break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_TGA)
+        case SCREENSHOT_FILE_TGA: success = stbi_write_tga(slot->path, slot->width, slot->height, 4, slot->pixels); break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_JPG)
+        case SCREENSHOT_FILE_JPG: success = stbi_write_jpg(slot->path, slot->width, slot->height, 4, slot->pixels, 90); break;  // JPG quality: between 1 and 100
+    #endif
+        case SCREENSHOT_FILE_RAW: success = SaveFileData(slot->path, slot->pixels, slot->height*pitch); break;
+        default: break;
+    }
+#endif
+
+    LockMutex(screenshots.lock);
+    slot->success = success;
+    slot->state = SCREENSHOT_SLOT_DONE;
+    UnlockMutex(screenshots.lock);
+}
+
+// Report finished async screenshots, free their slots
+static void PollScreenshots(void)
+{
+    if (screenshots.lock == NULL) return;
+
+    for (int i = 0; i < MAX_SCREENSHOT_SLOTS; i++)
+    {
+        ScreenshotSlot *slot = &screenshots.slots[i];
+
+        LockMutex(screenshots.lock);
+        bool done = (slot->state == SCREENSHOT_SLOT_DONE);
+        UnlockMutex(screenshots.lock);
+
+        if (!done) continue;
+
+#if defined(PLATFORM_WEB)
+        // Download file from MEMFS (emscripten memory filesystem)
+        // saveFileFromMEMFSToDisk() function is defined in raylib/src/shell.html
+        if (slot->success) emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", GetFileName(slot->path), GetFileName(slot->path)));
+#endif
+        if (slot->success) TRACELOG(LOG_INFO, "SYSTEM: [%s] Screenshot taken successfully", slot->path);
+        else TRACELOG(LOG_WARNING, "SYSTEM: [%s] Failed to save screenshot", slot->path);
+
+        if (screenshots.callback != NULL) screenshots.callback(slot->path, slot->success);
+
+        LockMutex(screenshots.lock);
+        slot->state = SCREENSHOT_SLOT_FREE;
+        UnlockMutex(screenshots.lock);
+    }
+}
+
+#if defined(SUPPORT_GIF_RECORDING)
+// Queue current frame readback for screen recording
+// NOTE: Readback is collected MAX_RECORDING_PIXEL_BUFFERS captures later, when GPU transfer is already done
+static void CaptureRecordingFrame(void)
+{
+    if (recording.pixelBuffers[0] > 0)
+    {
+        if (recording.pixelBuffersPending == MAX_RECORDING_PIXEL_BUFFERS) CollectRecordingFrame();
+
+        rlReadScreenPixelsAsync(recording.pixelBuffers[recording.pixelBuffersHead], recording.width, recording.height);
+
+        recording.pixelBuffersHead = (recording.pixelBuffersHead + 1)%MAX_RECORDING_PIXEL_BUFFERS;
+        recording.pixelBuffersPending++;
+    }
+    else
+    {
+        // Synchronous readback fallback, only encoding is done in background
+        // NOTE: rlReadScreenPixels() allocates its own buffer, copied to pooled frame
+        RecordingFrame *frame = AcquireRecordingFrame();
+
+        if (frame != NULL)
+        {
+            unsigned char *pixels = rlReadScreenPixels(recording.width, recording.height);
+            memcpy(frame->pixels, pixels, recording.width*recording.height*4);
+            RL_FREE(pixels);
+            frame->bottomUp = false;
+
+            QueueRecordingFrame(frame);
+        }
+        else recording.framesDropped++;
+    }
+}
+
+// Collect oldest frame readback and send it to encoder
+static void CollectRecordingFrame(void)
+{
+    int index = (recording.pixelBuffersHead - recording.pixelBuffersPending + MAX_RECORDING_PIXEL_BUFFERS)%MAX_RECORDING_PIXEL_BUFFERS;
+    int size = recording.width*recording.height*4;
+
+    recording.pixelBuffersPending--;
+
+    // Frame dropped if every pooled frame is waiting for encoder (readback not mapped)
+    RecordingFrame *frame = AcquireRecordingFrame();
+
+    if (frame == NULL)
+    {
+        recording.framesDropped++;
+        return;
+    }
+
+    frame->bottomUp = true;
+
+    if (rlReadPixelBuffer(recording.pixelBuffers[index], frame->pixels, size)) QueueRecordingFrame(frame);
+    else
+    {
+        ReleaseRecordingFrame(frame);
+        recording.framesDropped++;
+    }
+}
+
+// Take a free frame from pool, NULL if every frame is busy
+static RecordingFrame *AcquireRecordingFrame(void)
+{
+    RecordingFrame *frame = NULL;
+
+    LockMutex(recording.lock);
+    for (int i = 0; i < MAX_RECORDING_QUEUE_FRAMES; i++)
+    {
+        if (!recording.frames[i].busy)
+        {
+            frame = &recording.frames[i];
+            frame->busy = true;
+            break;
+        }
+    }
+    UnlockMutex(recording.lock);
+
+    return frame;
+}
+
+// Return frame to pool (main or encoder thread)
+static void ReleaseRecordingFrame(RecordingFrame *frame)
+{
+    LockMutex(recording.lock);
+    frame->busy = false;
+    UnlockMutex(recording.lock);
+}
+
+// Send frame to encoder thread, drop it if queue is full
+static void QueueRecordingFrame(RecordingFrame *frame)
+{
+    if (PushJob(recording.encoder, EncodeRecordingFrame, frame)) recording.framesEncoded++;
+    else
+    {
+        ReleaseRecordingFrame(frame);
+        recording.framesDropped++;
+    }
+}
+
+// Encode recording frame (runs on encoder thread)
+static void EncodeRecordingFrame(void *data)
+{
+    RecordingFrame *frame = (RecordingFrame *)data;
+    int width = recording.width;
+    int height = recording.height;
+
+    if (recording.rawVideo)
+    {
+        // Convert RGBA to YUV 4:4:4 planes (BT.601, studio range)
+        unsigned char *planeY = recording.rawPlanes;
+        unsigned char *planeU = planeY + width*height;
+        unsigned char *planeV = planeU + width*height;
+
+        for (int y = 0; y < height; y++)
+        {
+            const unsigned char *row = frame->pixels + (frame->bottomUp? (height - 1 - y) : y)*width*4;
+
+            for (int x = 0; x < width; x++)
+            {
+                int r = row[x*4], g = row[x*4 + 1], b = row[x*4 + 2];
+                int k = y*width + x;
+
+                planeY[k] = (unsigned char)(((66*r + 129*g + 25*b + 128) >> 8) + 16);
+                planeU[k] = (unsigned char)(((-38*r - 74*g + 112*b + 128) >> 8) + 128);
+                planeV[k] = (unsigned char)(((112*r - 94*g - 18*b + 128) >> 8) + 128);
+            }
+        }
+
+        fwrite("FRAME\n", 1, 6, recording.rawFile);
+        fwrite(recording.rawPlanes, 1, width*height*3, recording.rawFile);
+    }
+    else
+    {
+        // NOTE: Negative pitch makes msf_gif read rows bottom-up
+        msf_gif_frame(&recording.gifState, frame->pixels, 10, 16, frame->bottomUp? -width*4 : width*4);
+    }
+
+    ReleaseRecordingFrame(frame);
+}
+#endif  // SUPPORT_GIF_RECORDING
+
 // Copy back buffer to front buffers
 static void SwapBuffers(void)
 {
@@ -4595,47 +5195,18 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
 #if defined(SUPPORT_GIF_RECORDING)
         if (mods == GLFW_MOD_CONTROL)
         {
-            if (gifRecording)
-            {
-                gifRecording = false;
-
-                MsfGifResult result = msf_gif_end(&gifState);
-
-                char path[512] = { 0 };
-            #if defined(PLATFORM_ANDROID)
-                strcpy(path, CORE.Android.internalDataPath);
-                strcat(path, TextFormat("./screenrec%03i.gif", screenshotCounter));
-            #else
-                strcpy(path, TextFormat("./screenrec%03i.gif", screenshotCounter));
-            #endif
-
-                SaveFileData(path, result.data, (unsigned int)result.dataSize);
-                msf_gif_free(result);
-
-            #if defined(PLATFORM_WEB)
-                // Download file from MEMFS (emscripten memory filesystem)
-                // saveFileFromMEMFSToDisk() function is defined in raylib/templates/web_shel/shell.html
-                emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", TextFormat("screenrec%03i.gif", screenshotCounter - 1), TextFormat("screenrec%03i.gif", screenshotCounter - 1)));
-            #endif
-
-                TRACELOG(LOG_INFO, "SYSTEM: Finish animated GIF recording");
-            }
+            if (recording.active) EndScreenRecording();
             else
             {
-                gifRecording = true;
-                gifFramesCounter = 0;
-
-                msf_gif_begin(&gifState, CORE.Window.screen.width, CORE.Window.screen.height);
                 screenshotCounter++;
-
-                TRACELOG(LOG_INFO, "SYSTEM: Start animated GIF recording: %s", TextFormat("screenrec%03i.gif", screenshotCounter));
+                BeginScreenRecording(TextFormat("screenrec%03i.gif", screenshotCounter));
             }
         }
         else
 #endif  // SUPPORT_GIF_RECORDING
 #if defined(SUPPORT_SCREEN_CAPTURE)
         {
-            TakeScreenshot(TextFormat("screenshot%03i.png", screenshotCounter));
+            TakeScreenshotAsync(TextFormat("screenshot%03i.png", screenshotCounter));
             screenshotCounter++;
         }
 #endif  // SUPPORT_SCREEN_CAPTURE
@@ -5329,7 +5900,7 @@ static void ProcessKeyboard(void)
     // Check screen capture key (raylib key: KEY_F12)
     if (CORE.Input.Keyboard.currentKeyState[301] == 1)
     {
-        TakeScreenshot(TextFormat("screenshot%03i.png", screenshotCounter));
+        TakeScreenshotAsync(TextFormat("screenshot%03i.png", screenshotCounter));
         screenshotCounter++;
     }
 #endif
@@ -5945,38 +6516,18 @@ void UWPKeyDownEvent(int key, bool down, bool controlKey)
 #if defined(SUPPORT_GIF_RECORDING)
         if (controlKey)
         {
-            if (gifRecording)
-            {
-                gifRecording = false;
-
-                MsfGifResult result = msf_gif_end(&gifState);
-
-                SaveFileData(TextFormat("%s/screenrec%03i.gif", CORE.UWP.internalDataPath, screenshotCounter), result.data, result.dataSize);
-                msf_gif_free(result);
-
-#if defined(PLATFORM_WEB)
-                // Download file from MEMFS (emscripten memory filesystem)
-                // saveFileFromMEMFSToDisk() function is defined in raylib/templates/web_shel/shell.html
-                emscripten_run_script(TextFormat("saveFileFromMEMFSToDisk('%s','%s')", TextFormat("screenrec%03i.gif", screenshotCounter - 1), TextFormat("screenrec%03i.gif", screenshotCounter - 1)));
-#endif
-                TRACELOG(LOG_INFO, "SYSTEM: Finish animated GIF recording");
-            }
+            if (recording.active) EndScreenRecording();
             else
             {
-                gifRecording = true;
-                gifFramesCounter = 0;
-
-                msf_gif_begin(&gifState, CORE.Window.screen.width, CORE.Window.screen.height);
                 screenshotCounter++;
-
-                TRACELOG(LOG_INFO, "SYSTEM: Start animated GIF recording: %s", TextFormat("screenrec%03i.gif", screenshotCounter));
+                BeginScreenRecording(TextFormat("screenrec%03i.gif", screenshotCounter));
             }
         }
         else
 #endif  // SUPPORT_GIF_RECORDING
 #if defined(SUPPORT_SCREEN_CAPTURE)
         {
-            TakeScreenshot(TextFormat("screenshot%03i.png", screenshotCounter));
+            TakeScreenshotAsync(TextFormat("screenshot%03i.png", screenshotCounter));
             screenshotCounter++;
         }
 #endif  // SUPPORT_SCREEN_CAPTURE
@@ -168,6 +168,24 @@ typedef struct tagBITMAPINFOHEADER {
 
 #include <stdlib.h>                     // Required for: malloc(), free()
 #include <stdio.h>                      // Required for: FILE, fopen(), fclose(), fread()
+#include <math.h>                       // Required for: fmodf()
+
+#if defined(SUPPORT_AUDIO_MIXING_SIMD)
+    // SIMD instruction sets used by mixing kernels, as enabled by compiler flags
+    #if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+        #define AUDIO_MIXING_SSE
+        #include <xmmintrin.h>          // Required for: SSE intrinsics
+    #endif
+    #if defined(__AVX__)
+        #define AUDIO_MIXING_AVX
+        #include <immintrin.h>          // Required for: AVX intrinsics
+    #endif
+    // NOTE: NEON kernels are not checked yet (SetAudioMixingSimd()), they must be enabled explicitly
+    #if defined(SUPPORT_AUDIO_MIXING_NEON) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+        #define AUDIO_MIXING_NEON
+        #include <arm_neon.h>           // Required for: NEON intrinsics
+    #endif
+#endif
 
 #if defined(RAUDIO_STANDALONE)
     #include <string.h>                 // Required for: strcmp() [Used in IsFileExtension()]
@@ -264,6 +282,12 @@ typedef struct tagBITMAPINFOHEADER {
 #ifndef DEFAULT_AUDIO_BUFFER_SIZE
     #define DEFAULT_AUDIO_BUFFER_SIZE       4096    // Default audio buffer size
 #endif
+#ifndef MUSIC_DECODER_SLEEP_TIME
+    #define MUSIC_DECODER_SLEEP_TIME           5    // Music decoder thread wait time (in milliseconds) when frames ring buffer is full
+#endif
+#ifndef MAX_AUDIO_COMMANDS
+    #define MAX_AUDIO_COMMANDS              1024    // Audio commands queued between two mixings (power of two)
+#endif
 
 
 //----------------------------------------------------------------------------------
@@ -302,48 +326,136 @@ typedef enum {
     AUDIO_BUFFER_USAGE_STREAM
 } AudioBufferUsage;
 
+typedef struct MusicDecoder MusicDecoder;
+
 // Audio buffer structure
+// NOTE: Playback state and parameters are owned by mixer (audio thread), changed by audio commands
+// sent by user (game thread), that keeps its own view of requested playback state
 struct rAudioBuffer {
     ma_data_converter converter;    // Audio data converter
 
     float volume;                   // Audio buffer volume
     float pitch;                    // Audio buffer pitch
+    float pan;                      // Audio buffer pan (0.0 left, 0.5 center, 1.0 right)
 
     bool playing;                   // Audio buffer state: AUDIO_PLAYING
     bool paused;                    // Audio buffer state: AUDIO_PAUSED
     bool looping;                   // Audio buffer looping, always true for AudioStreams
     int usage;                      // Audio buffer usage mode: STATIC or STREAM
 
-    bool isSubBufferProcessed[2];   // SubBuffer processed (virtual double buffer)
+    ma_uint32 isSubBufferProcessed[2];  // SubBuffer processed (virtual double buffer), atomic: sub-buffers handed over between threads
     unsigned int sizeInFrames;      // Total buffer size in frames
     unsigned int frameCursorPos;    // Frame cursor position
     unsigned int totalFramesProcessed;  // Total frames processed in this buffer (required for play timing)
 
     unsigned char *data;            // Data buffer, on music stream keeps filling
 
+    bool playRequested;             // User: play requested (not stopped)
+    bool pauseRequested;            // User: pause requested
+    unsigned int playCount;         // User: play requests count
+    unsigned int subBufferToUpdate; // User: next stream sub-buffer to update, sub-buffers are filled and played in turn
+    unsigned int mixerPlayCount;    // Mixer: play request being mixed
+    ma_uint32 endedPlayCount;       // Play request ended by mixer, atomic
+    ma_uint32 stopPending;          // Stop commands pushed and not yet applied by mixer (stream sub-buffers not available), atomic
+    int poolIndex;                  // Multichannel pool channel index, -1 if not a pool buffer
+    MusicDecoder *decoder;          // Music decoded ahead (frames read from decoder), NULL otherwise
+
     rAudioBuffer *next;             // Next audio buffer on the list
     rAudioBuffer *prev;             // Previous audio buffer on the list
 };
 
 #define AudioBuffer rAudioBuffer    // HACK: To avoid CoreAudio (macOS) symbol collision
 
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+// Music decoder: music decoded ahead by a background thread into a frames ring buffer (device format), read by mixer
+// NOTE: Single producer (decoder) single consumer (mixer), music context is only used by decoder thread
+struct MusicDecoder {
+    Music music;                    // Decoded music
+    ma_thread thread;               // Decoder thread
+    ma_data_converter converter;    // Music format to device format converter (base pitch)
+
+    void *pcm;                      // Decoded samples (reused)
+    float *converted;               // Converted frames (reused)
+    unsigned int chunkFrames;       // Music frames decoded at once
+    unsigned int convertedFrames;   // Converted frames capacity
+
+    float *frames;                  // Frames ring buffer
+    ma_uint32 capacity;             // Frames ring buffer capacity (power of two: frame counters wrap around)
+    ma_uint32 written;              // Frames written by decoder, atomic
+    ma_uint32 read;                 // Frames read by mixer, atomic
+    ma_uint32 ended;                // Music decoded to its end (not looping), waiting for mixer to play it, atomic
+
+    ma_uint32 restartRequested;     // Restarts requested by user (StopMusicStream()), atomic
+    ma_uint32 restartDone;          // Restarts done by decoder, atomic
+    ma_uint32 restartFrame;         // First frame written after last restart, atomic
+    ma_uint32 restartApplied;       // Restarts applied by mixer (mixer)
+    ma_uint32 framesPlayed;         // Frames read by mixer since last restart, atomic
+    ma_uint32 quit;                 // Decoder thread exit requested, atomic
+};
+#endif
+
+// Audio command type
+typedef enum {
+    AUDIO_COMMAND_PLAY = 0,         // Play buffer (with source buffer data and parameters if provided)
+    AUDIO_COMMAND_STOP,
+    AUDIO_COMMAND_PAUSE,
+    AUDIO_COMMAND_RESUME,
+    AUDIO_COMMAND_VOLUME,
+    AUDIO_COMMAND_PITCH,
+    AUDIO_COMMAND_PAN,
+    AUDIO_COMMAND_MASTER_VOLUME
+} AudioCommandType;
+
+// Audio command, sent by user (game thread) and applied by mixer before next mixing
+typedef struct AudioCommand {
+    int type;                       // Command type (AudioCommandType)
+    AudioBuffer *buffer;            // Audio buffer changed
+    AudioBuffer *source;            // Play: source buffer (PlaySoundMulti()), NULL to play buffer data
+    float value;                    // Volume, pitch or pan
+    unsigned int playCount;         // Play: request count
+    float pitch;                    // Play: source pitch factor (value is source volume factor)
+} AudioCommand;
+
 // Audio data context
 typedef struct AudioData {
     struct {
         ma_context context;         // miniaudio context data
         ma_device device;           // miniaudio device
-        ma_mutex lock;              // miniaudio mutex lock
+        ma_mutex lock;              // miniaudio mutex lock: audio buffers list, mixing
+        float masterVolume;         // Master volume (mixer), applied at mixing
         bool isReady;               // Check if audio device is ready
+        bool isOffline;             // Device not started, mixer driven by RenderAudioFrames()
+        ma_timer timer;             // Mixing timer
+        double mixingTime;          // Time spent mixing (mixer)
+        ma_uint32 mixingMicroseconds;   // Time spent mixing, atomic
+        ma_uint32 mixedFrames;      // Frames mixed, atomic
+        ma_uint32 loadMicroseconds; // Mixing load: time spent mixing at last request
+        ma_uint32 loadFrames;       // Mixing load: frames mixed at last request
     } System;
+    struct {
+        AudioCommand queue[MAX_AUDIO_COMMANDS]; // Commands ring buffer, single producer (user) single consumer (mixer)
+        ma_uint32 pushed;           // Commands pushed count, atomic
+        ma_uint32 applied;          // Commands applied count, atomic
+    } Command;
     struct {
         AudioBuffer *first;         // Pointer to first AudioBuffer in the list
         AudioBuffer *last;          // Pointer to last AudioBuffer in the list
         int defaultSize;            // Default audio buffer size for audio streams
+        void *musicPcm;             // Music samples read by UpdateMusicStream() (reused)
+        unsigned int musicPcmSize;  // Music samples buffer size (in bytes)
     } Buffer;
     struct {
         AudioBuffer *pool[MAX_AUDIO_BUFFER_POOL_CHANNELS];      // Multichannel AudioBuffer pointers pool
         unsigned int poolCounter;                               // AudioBuffer pointers pool counter
-        unsigned int channels[MAX_AUDIO_BUFFER_POOL_CHANNELS];  // AudioBuffer pool channels
+        unsigned int channels[MAX_AUDIO_BUFFER_POOL_CHANNELS];  // AudioBuffer pool channels (age)
+        float volume[MAX_AUDIO_BUFFER_POOL_CHANNELS];           // AudioBuffer pool channels volume (loudness)
+        int priority[MAX_AUDIO_BUFFER_POOL_CHANNELS];           // AudioBuffer pool channels priority
+        bool isFree[MAX_AUDIO_BUFFER_POOL_CHANNELS];            // AudioBuffer pool channel is in free list
+        int freeList[MAX_AUDIO_BUFFER_POOL_CHANNELS];           // Free channels stack (user)
+        int freeCount;                                          // Free channels count
+        ma_uint32 ended[MAX_AUDIO_BUFFER_POOL_CHANNELS];        // Ended channels ring buffer, pushed by mixer (lock held), popped by user
+        ma_uint32 endedPushed;                                  // Ended channels pushed count, atomic
+        ma_uint32 endedPopped;                                  // Ended channels popped count, atomic
     } MultiChannel;
 } AudioData;
 
@@ -359,12 +471,29 @@ static AudioData AUDIO = {          // Global AUDIO context
     .Buffer.defaultSize = DEFAULT_AUDIO_BUFFER_SIZE
 };
 
+static bool audioMixingSimd = true;     // SIMD mixing kernels enabled (disabled to check them against scalar code)
+
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
 //----------------------------------------------------------------------------------
 static void OnLog(ma_context *pContext, ma_device *pDevice, ma_uint32 logLevel, const char *message);
 static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount);
-static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, float localVolume);
+static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer);
+static void InitAudioDeviceBackend(const ma_backend *backends, ma_uint32 backendCount, bool offline);  // Initialize audio device on first available backend (all if NULL)
+
+static bool PushAudioCommand(AudioCommand command);     // Push audio command to mixer (never blocks), false if queue is full
+static void ApplyAudioCommand(const AudioCommand *command);   // Apply audio command (mixer)
+static void ApplyAudioCommands(void);                   // Apply pushed audio commands (mixer, or user holding the lock)
+static void EndAudioBuffer(AudioBuffer *buffer);        // Stop audio buffer (mixer): stop command or sound end
+
+static void SeekMusicStart(Music music);                // Seek music to its start
+static void ReadMusicSamples(Music music, void *pcm, int samplesCount);    // Read music samples from its current position
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+static ma_thread_result MA_THREADCALL MusicDecoderThread(void *data);  // Music decoder thread: decodes music ahead
+static ma_uint32 ReadMusicDecoderFrames(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount);   // Read music decoded ahead (mixer)
+static void WaitMusicDecoderFrames(MusicDecoder *decoder, ma_uint32 frameCount);    // Wait for frames decoded ahead (offline mixer)
+static void UnloadMusicDecoder(Music music);            // Stop music decoder thread and unload its data
+#endif
 
 static void InitAudioBufferPool(void);                  // Initialise the multichannel buffer pool
 static void CloseAudioBufferPool(void);                 // Close the audio buffers pool
@@ -404,6 +533,7 @@ void PauseAudioBuffer(AudioBuffer *buffer);
 void ResumeAudioBuffer(AudioBuffer *buffer);
 void SetAudioBufferVolume(AudioBuffer *buffer, float volume);
 void SetAudioBufferPitch(AudioBuffer *buffer, float pitch);
+void SetAudioBufferPan(AudioBuffer *buffer, float pan);
 void TrackAudioBuffer(AudioBuffer *buffer);
 void UntrackAudioBuffer(AudioBuffer *buffer);
 
@@ -412,6 +542,31 @@ void UntrackAudioBuffer(AudioBuffer *buffer);
 //----------------------------------------------------------------------------------
 // Initialize audio device
 void InitAudioDevice(void)
+{
+    InitAudioDeviceBackend(NULL, 0, false);
+}
+
+// Initialize audio device on null backend
+// NOTE: No sound output, device is still consuming mixed audio at real time rate
+void InitAudioDeviceNull(void)
+{
+    ma_backend backend = ma_backend_null;
+
+    InitAudioDeviceBackend(&backend, 1, false);
+}
+
+// Initialize audio device for offline rendering (null backend, device not started)
+// NOTE: Nothing is mixed until RenderAudioFrames() is called, faster than real time
+void InitAudioDeviceOffline(void)
+{
+    ma_backend backend = ma_backend_null;
+
+    InitAudioDeviceBackend(&backend, 1, true);
+}
+
+// Initialize audio device on first available backend
+// NOTE: Offline device is not started, mixer is driven by RenderAudioFrames()
+static void InitAudioDeviceBackend(const ma_backend *backends, ma_uint32 backendCount, bool offline)
 {
     // TODO: Load AUDIO context memory dynamically?
 
@@ -419,7 +574,7 @@ void InitAudioDevice(void)
     ma_context_config ctxConfig = ma_context_config_init();
     ctxConfig.logCallback = OnLog;
 
-    ma_result result = ma_context_init(NULL, 0, &ctxConfig, &AUDIO.System.context);
+    ma_result result = ma_context_init(backends, backendCount, &ctxConfig, &AUDIO.System.context);
     if (result != MA_SUCCESS)
     {
         TRACELOG(LOG_ERROR, "AUDIO: Failed to initialize context");
@@ -447,24 +602,34 @@ void InitAudioDevice(void)
         return;
     }
 
-    // Keep the device running the whole time. May want to consider doing something a bit smarter and only have the device running
-    // while there's at least one sound being played.
-    result = ma_device_start(&AUDIO.System.device);
-    if (result != MA_SUCCESS)
+    // Mixing happens on a seperate thread which means we need to synchronize. Playback changes are sent to mixer
+    // as audio commands (lock-free), the mutex is only used to load/unload audio buffers.
+    // NOTE: Mutex is required by mixer as soon as device is started
+    if (ma_mutex_init(&AUDIO.System.lock) != MA_SUCCESS)
     {
-        TRACELOG(LOG_ERROR, "AUDIO: Failed to start playback device");
+        TRACELOG(LOG_ERROR, "AUDIO: Failed to create mutex for mixing");
         ma_device_uninit(&AUDIO.System.device);
         ma_context_uninit(&AUDIO.System.context);
         return;
     }
 
-    // Mixing happens on a seperate thread which means we need to synchronize. I'm using a mutex here to make things simple, but may
-    // want to look at something a bit smarter later on to keep everything real-time, if that's necessary.
-    if (ma_mutex_init(&AUDIO.System.lock) != MA_SUCCESS)
+    AUDIO.System.masterVolume = 1.0f;
+    AUDIO.System.mixingTime = 0.0;
+    AUDIO.System.mixingMicroseconds = 0;
+    AUDIO.System.mixedFrames = 0;
+    AUDIO.System.loadMicroseconds = 0;
+    AUDIO.System.loadFrames = 0;
+    ma_timer_init(&AUDIO.System.timer);
+
+    // Keep the device running the whole time. May want to consider doing something a bit smarter and only have the device running
+    // while there's at least one sound being played.
+    if (!offline) result = ma_device_start(&AUDIO.System.device);
+    if (result != MA_SUCCESS)
     {
-        TRACELOG(LOG_ERROR, "AUDIO: Failed to create mutex for mixing");
+        TRACELOG(LOG_ERROR, "AUDIO: Failed to start playback device");
         ma_device_uninit(&AUDIO.System.device);
         ma_context_uninit(&AUDIO.System.context);
+        ma_mutex_uninit(&AUDIO.System.lock);
         return;
     }
 
@@ -475,8 +640,11 @@ void InitAudioDevice(void)
     TRACELOG(LOG_INFO, "    > Sample rate:   %d -> %d", AUDIO.System.device.sampleRate, AUDIO.System.device.playback.internalSampleRate);
     TRACELOG(LOG_INFO, "    > Periods size:  %d", AUDIO.System.device.playback.internalPeriodSizeInFrames*AUDIO.System.device.playback.internalPeriods);
 
+    if (offline) TRACELOG(LOG_INFO, "    > Offline:       mixed by RenderAudioFrames()");
+
     InitAudioBufferPool();
 
+    AUDIO.System.isOffline = offline;
     AUDIO.System.isReady = true;
 }
 
@@ -485,12 +653,22 @@ void CloseAudioDevice(void)
 {
     if (AUDIO.System.isReady)
     {
-        ma_mutex_uninit(&AUDIO.System.lock);
+        // NOTE: Device is stopped first, mixer could be waiting for lock
         ma_device_uninit(&AUDIO.System.device);
         ma_context_uninit(&AUDIO.System.context);
+        ma_mutex_uninit(&AUDIO.System.lock);
+
+        AUDIO.System.isReady = false;
+        AUDIO.System.isOffline = false;
+        AUDIO.Command.pushed = 0;
+        AUDIO.Command.applied = 0;
 
         CloseAudioBufferPool();
 
+        RL_FREE(AUDIO.Buffer.musicPcm);
+        AUDIO.Buffer.musicPcm = NULL;
+        AUDIO.Buffer.musicPcmSize = 0;
+
         TRACELOG(LOG_INFO, "AUDIO: Device closed successfully");
     }
     else TRACELOG(LOG_WARNING, "AUDIO: Device could not be closed, not currently initialized");
@@ -505,7 +683,59 @@ bool IsAudioDeviceReady(void)
 // Set master volume (listener)
 void SetMasterVolume(float volume)
 {
-    ma_device_set_master_volume(&AUDIO.System.device, volume);
+    AudioCommand command = { AUDIO_COMMAND_MASTER_VOLUME, NULL, NULL, volume, 0 };
+    PushAudioCommand(command);
+}
+
+// Get mixer load since last call: time spent mixing / duration of audio mixed
+// NOTE: 1.0 means mixing takes a full core, 0.0 if nothing mixed
+float GetAudioMixingLoad(void)
+{
+    float load = 0.0f;
+
+    if (AUDIO.System.isReady)
+    {
+        ma_uint32 microseconds = c89atomic_load_explicit_32(&AUDIO.System.mixingMicroseconds, c89atomic_memory_order_acquire);
+        ma_uint32 frames = c89atomic_load_explicit_32(&AUDIO.System.mixedFrames, c89atomic_memory_order_acquire);
+
+        if (frames != AUDIO.System.loadFrames) load = (microseconds - AUDIO.System.loadMicroseconds)*AUDIO.System.device.sampleRate/(1000000.0f*(frames - AUDIO.System.loadFrames));
+
+        AUDIO.System.loadMicroseconds = microseconds;
+        AUDIO.System.loadFrames = frames;
+    }
+
+    return load;
+}
+
+// Render audio offline: mix frameCount frames into frames (device format: 32bit float, AUDIO_DEVICE_CHANNELS interleaved)
+// NOTE: Device must be initialized by InitAudioDeviceOffline(), playback changes are applied before mixing
+void RenderAudioFrames(float *frames, int frameCount)
+{
+    if (!AUDIO.System.isReady || !AUDIO.System.isOffline)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Frames can only be rendered by offline audio device");
+        return;
+    }
+
+    // Mixed by blocks of device period size, as a running device would do
+    ma_uint32 periodFrames = AUDIO.System.device.playback.internalPeriodSizeInFrames;
+    if (periodFrames == 0) periodFrames = (ma_uint32)frameCount;
+
+    for (int framesRendered = 0; framesRendered < frameCount; )
+    {
+        ma_uint32 framesToRender = (ma_uint32)(frameCount - framesRendered);
+        if (framesToRender > periodFrames) framesToRender = periodFrames;
+
+        OnSendAudioDataToDevice(&AUDIO.System.device, frames + framesRendered*AUDIO_DEVICE_CHANNELS, NULL, framesToRender);
+        framesRendered += framesToRender;
+    }
+}
+
+// Enable SIMD mixing kernels (enabled by default), scalar code is used when disabled
+// NOTE: Set it before mixing, disabling them allows to check MixAudioSamples() and ClampAudioSamples() kernels
+void SetAudioMixingSimd(bool enabled)
+{
+    audioMixingSimd = enabled;
 }
 
 //----------------------------------------------------------------------------------
@@ -541,12 +771,14 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
     // Init audio buffer values
     audioBuffer->volume = 1.0f;
     audioBuffer->pitch = 1.0f;
+    audioBuffer->pan = 0.5f;
     audioBuffer->playing = false;
     audioBuffer->paused = false;
     audioBuffer->looping = false;
     audioBuffer->usage = usage;
     audioBuffer->frameCursorPos = 0;
     audioBuffer->sizeInFrames = sizeInFrames;
+    audioBuffer->poolIndex = -1;
 
     // Buffers should be marked as processed by default so that a call to
     // UpdateAudioStream() immediately after initialization works correctly
@@ -564,69 +796,94 @@ void UnloadAudioBuffer(AudioBuffer *buffer)
 {
     if (buffer != NULL)
     {
+        UntrackAudioBuffer(buffer);     // Buffer is not mixed anymore
         ma_data_converter_uninit(&buffer->converter);
-        UntrackAudioBuffer(buffer);
         RL_FREE(buffer->data);
         RL_FREE(buffer);
     }
 }
 
 // Check if an audio buffer is playing
+// NOTE: Requested playback state, sound end is reported by mixer
 bool IsAudioBufferPlaying(AudioBuffer *buffer)
 {
     bool result = false;
 
-    if (buffer != NULL) result = (buffer->playing && !buffer->paused);
+    if (buffer != NULL) result = (buffer->playRequested && !buffer->pauseRequested && (c89atomic_load_explicit_32(&buffer->endedPlayCount, c89atomic_memory_order_acquire) != buffer->playCount));
 
     return result;
 }
 
 // Play an audio buffer
-// NOTE: Buffer is restarted to the start.
+// NOTE: Static buffer is restarted to the start, stream continues playing its queued sub-buffers.
 // Use PauseAudioBuffer() and ResumeAudioBuffer() if the playback position should be maintained.
 void PlayAudioBuffer(AudioBuffer *buffer)
 {
     if (buffer != NULL)
     {
-        buffer->playing = true;
-        buffer->paused = false;
-        buffer->frameCursorPos = 0;
+        if ((buffer->usage == AUDIO_BUFFER_USAGE_STREAM) && IsAudioBufferPlaying(buffer)) return;
+
+        AudioCommand command = { AUDIO_COMMAND_PLAY, buffer, NULL, 0.0f, buffer->playCount + 1 };
+
+        if (PushAudioCommand(command))
+        {
+            buffer->playRequested = true;
+            buffer->pauseRequested = false;
+            buffer->playCount++;
+        }
     }
 }
 
 // Stop an audio buffer
+// NOTE: Stream sub-buffers are not available for updating until mixer has stopped it
 void StopAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL)
+    if ((buffer != NULL) && buffer->playRequested)
     {
-        if (IsAudioBufferPlaying(buffer))
+        AudioCommand command = { AUDIO_COMMAND_STOP, buffer, NULL, 0.0f, 0 };
+
+        // NOTE: Counted before pushing, the command can be applied right away by PushAudioCommand()
+        c89atomic_fetch_add_explicit_32(&buffer->stopPending, 1, c89atomic_memory_order_release);
+
+        if (PushAudioCommand(command))
         {
-            buffer->playing = false;
-            buffer->paused = false;
-            buffer->frameCursorPos = 0;
+            buffer->playRequested = false;
+            buffer->pauseRequested = false;
             buffer->totalFramesProcessed = 0;
-            buffer->isSubBufferProcessed[0] = true;
-            buffer->isSubBufferProcessed[1] = true;
+            buffer->subBufferToUpdate = 0;
         }
+        else c89atomic_fetch_sub_explicit_32(&buffer->stopPending, 1, c89atomic_memory_order_release);
     }
 }
 
 // Pause an audio buffer
 void PauseAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL) buffer->paused = true;
+    if (buffer != NULL)
+    {
+        AudioCommand command = { AUDIO_COMMAND_PAUSE, buffer, NULL, 0.0f, 0 };
+        if (PushAudioCommand(command)) buffer->pauseRequested = true;
+    }
 }
 
 // Resume an audio buffer
 void ResumeAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL) buffer->paused = false;
+    if (buffer != NULL)
+    {
+        AudioCommand command = { AUDIO_COMMAND_RESUME, buffer, NULL, 0.0f, 0 };
+        if (PushAudioCommand(command)) buffer->pauseRequested = false;
+    }
 }
 
 // Set volume for an audio buffer
 void SetAudioBufferVolume(AudioBuffer *buffer, float volume)
 {
-    if (buffer != NULL) buffer->volume = volume;
+    if (buffer != NULL)
+    {
+        AudioCommand command = { AUDIO_COMMAND_VOLUME, buffer, NULL, volume, 0 };
+        PushAudioCommand(command);
+    }
 }
 
 // Set pitch for an audio buffer
@@ -634,14 +891,21 @@ void SetAudioBufferPitch(AudioBuffer *buffer, float pitch)
 {
     if ((buffer != NULL) && (pitch > 0.0f))
     {
-        // Pitching is just an adjustment of the sample rate.
-        // Note that this changes the duration of the sound:
-        //  - higher pitches will make the sound faster
-        //  - lower pitches make it slower
-        ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.config.sampleRateOut/pitch);
-        ma_data_converter_set_rate(&buffer->converter, buffer->converter.config.sampleRateIn, outputSampleRate);
+        AudioCommand command = { AUDIO_COMMAND_PITCH, buffer, NULL, pitch, 0 };
+        PushAudioCommand(command);
+    }
+}
 
-        buffer->pitch = pitch;
+// Set pan for an audio buffer
+void SetAudioBufferPan(AudioBuffer *buffer, float pan)
+{
+    if (buffer != NULL)
+    {
+        if (pan < 0.0f) pan = 0.0f;
+        else if (pan > 1.0f) pan = 1.0f;
+
+        AudioCommand command = { AUDIO_COMMAND_PAN, buffer, NULL, pan, 0 };
+        PushAudioCommand(command);
     }
 }
 
@@ -663,10 +927,26 @@ void TrackAudioBuffer(AudioBuffer *buffer)
 }
 
 // Untrack audio buffer from linked list
+// NOTE: Pending commands are applied first (buffer not referenced anymore) and
+// multichannel pool sounds playing buffer data are stopped
 void UntrackAudioBuffer(AudioBuffer *buffer)
 {
     ma_mutex_lock(&AUDIO.System.lock);
     {
+        ApplyAudioCommands();
+
+        for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
+        {
+            AudioBuffer *channel = AUDIO.MultiChannel.pool[i];
+
+            if ((channel != NULL) && (channel != buffer) && (buffer->data != NULL) && (channel->data == buffer->data))
+            {
+                EndAudioBuffer(channel);
+                channel->data = NULL;
+                channel->sizeInFrames = 0;
+            }
+        }
+
         if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
         else buffer->prev->next = buffer->next;
 
@@ -709,7 +989,8 @@ Wave LoadWaveFromMemory(const char *fileType, const unsigned char *fileData, int
     Wave wave = { 0 };
 
     char fileExtLower[16] = { 0 };
-    strcpy(fileExtLower, TextToLower(fileType));
+    // NOTE: Lowered locally, TextToLower() static buffer is not safe for loading from multiple threads
+    for (int i = 0; (i < 15) && (fileType[i] != '\0'); i++) fileExtLower[i] = ((fileType[i] >= 'A') && (fileType[i] <= 'Z'))? fileType[i] + 32 : fileType[i];
 
     if (false) { }
 #if defined(SUPPORT_FILEFORMAT_WAV)
@@ -762,7 +1043,10 @@ Sound LoadSoundFromWave(Wave wave)
         ma_format formatIn  = ((wave.sampleSize == 8)? ma_format_u8 : ((wave.sampleSize == 16)? ma_format_s16 : ma_format_f32));
         ma_uint32 frameCountIn = wave.sampleCount/wave.channels;
 
-        ma_uint32 frameCount = (ma_uint32)ma_convert_frames(NULL, 0, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO_DEVICE_SAMPLE_RATE, NULL, frameCountIn, formatIn, wave.channels, wave.sampleRate);
+        // Wave already in device format (i.e. converted by WaveFormat() or cached), samples copied without conversion
+        bool deviceFormat = (formatIn == AUDIO_DEVICE_FORMAT) && (wave.channels == AUDIO_DEVICE_CHANNELS) && (wave.sampleRate == AUDIO_DEVICE_SAMPLE_RATE);
+
+        ma_uint32 frameCount = deviceFormat? frameCountIn : (ma_uint32)ma_convert_frames(NULL, 0, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO_DEVICE_SAMPLE_RATE, NULL, frameCountIn, formatIn, wave.channels, wave.sampleRate);
         if (frameCount == 0) TRACELOG(LOG_WARNING, "SOUND: Failed to get frame count for format conversion");
 
         AudioBuffer *audioBuffer = LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO_DEVICE_SAMPLE_RATE, frameCount, AUDIO_BUFFER_USAGE_STATIC);
@@ -772,8 +1056,12 @@ Sound LoadSoundFromWave(Wave wave)
             return sound; // early return to avoid dereferencing the audioBuffer null pointer
         }
 
-        frameCount = (ma_uint32)ma_convert_frames(audioBuffer->data, frameCount, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO_DEVICE_SAMPLE_RATE, wave.data, frameCountIn, formatIn, wave.channels, wave.sampleRate);
-        if (frameCount == 0) TRACELOG(LOG_WARNING, "SOUND: Failed format conversion");
+        if (deviceFormat) memcpy(audioBuffer->data, wave.data, frameCount*ma_get_bytes_per_frame(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS));
+        else
+        {
+            frameCount = (ma_uint32)ma_convert_frames(audioBuffer->data, frameCount, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO_DEVICE_SAMPLE_RATE, wave.data, frameCountIn, formatIn, wave.channels, wave.sampleRate);
+            if (frameCount == 0) TRACELOG(LOG_WARNING, "SOUND: Failed format conversion");
+        }
 
         sound.sampleCount = frameCount*AUDIO_DEVICE_CHANNELS;
         sound.stream.sampleRate = AUDIO_DEVICE_SAMPLE_RATE;
@@ -808,8 +1096,11 @@ void UpdateSound(Sound sound, const void *data, int samplesCount)
     {
         StopAudioBuffer(sound.stream.buffer);
 
-        // TODO: May want to lock/unlock this since this data buffer is read at mixing time
+        // NOTE: Data buffer is read at mixing time, stop is applied before updating it
+        ma_mutex_lock(&AUDIO.System.lock);
+        ApplyAudioCommands();
         memcpy(sound.stream.buffer->data, data, samplesCount*ma_get_bytes_per_frame(sound.stream.buffer->converter.config.formatIn, sound.stream.buffer->converter.config.channelsIn));
+        ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
 
@@ -899,61 +1190,92 @@ void PlaySound(Sound sound)
 // Play a sound in the multichannel buffer pool
 void PlaySoundMulti(Sound sound)
 {
-    int index = -1;
-    unsigned int oldAge = 0;
-    int oldIndex = -1;
+    PlaySoundMultiEx(sound, 1.0f, 1.0f, 0);
+}
 
-    // find the first non playing pool entry
-    for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
+// Play a sound in the multichannel buffer pool, with volume, pitch and priority
+// NOTE: Free channels are taken from a free list (ended channels are reported by mixer),
+// if none is free, the channel with lowest priority, then lowest volume, then oldest is stolen,
+// unless the new sound has a lower priority or volume (new sound is not played)
+void PlaySoundMultiEx(Sound sound, float volume, float pitch, int priority)
+{
+    if ((sound.stream.buffer == NULL) || (pitch <= 0.0f)) return;
+
+    // Ended channels are returned to free list
+    ma_uint32 endedPopped = c89atomic_load_explicit_32(&AUDIO.MultiChannel.endedPopped, c89atomic_memory_order_relaxed);
+    ma_uint32 endedPushed = c89atomic_load_explicit_32(&AUDIO.MultiChannel.endedPushed, c89atomic_memory_order_acquire);
+
+    for (; endedPopped != endedPushed; endedPopped++)
     {
-        if (AUDIO.MultiChannel.channels[i] > oldAge)
-        {
-            oldAge = AUDIO.MultiChannel.channels[i];
-            oldIndex = i;
-        }
+        int i = AUDIO.MultiChannel.ended[endedPopped%MAX_AUDIO_BUFFER_POOL_CHANNELS];
 
-        if (!IsAudioBufferPlaying(AUDIO.MultiChannel.pool[i]))
+        // NOTE: Channel could have been stolen (played again) since it ended
+        if (!AUDIO.MultiChannel.isFree[i] && !IsAudioBufferPlaying(AUDIO.MultiChannel.pool[i]))
         {
-            index = i;
-            break;
+            AUDIO.MultiChannel.isFree[i] = true;
+            AUDIO.MultiChannel.freeList[AUDIO.MultiChannel.freeCount++] = i;
         }
     }
 
-    // If no none playing pool members can be index choose the oldest
-    if (index == -1)
-    {
-        TRACELOG(LOG_WARNING, "SOUND: Buffer pool is already full, count: %i", AUDIO.MultiChannel.poolCounter);
+    c89atomic_store_explicit_32(&AUDIO.MultiChannel.endedPopped, endedPopped, c89atomic_memory_order_release);
 
-        if (oldIndex == -1)
+    int index = -1;
+
+    if (AUDIO.MultiChannel.freeCount > 0) index = AUDIO.MultiChannel.freeList[AUDIO.MultiChannel.freeCount - 1];
+    else
+    {
+        // Look for a channel to steal (or a channel ended but not reported)
+        for (int i = 0; i < MAX_AUDIO_BUFFER_POOL_CHANNELS; i++)
         {
-            // Shouldn't be able to get here... but just in case something odd happens!
-            TRACELOG(LOG_WARNING, "SOUND: Buffer pool could not determine oldest buffer not playing sound");
-            return;
+            if (!IsAudioBufferPlaying(AUDIO.MultiChannel.pool[i]))
+            {
+                index = i;
+                break;
+            }
+
+            if ((index == -1) ||
+                (AUDIO.MultiChannel.priority[i] < AUDIO.MultiChannel.priority[index]) ||
+                ((AUDIO.MultiChannel.priority[i] == AUDIO.MultiChannel.priority[index]) &&
+                 ((AUDIO.MultiChannel.volume[i] < AUDIO.MultiChannel.volume[index]) ||
+                  ((AUDIO.MultiChannel.volume[i] == AUDIO.MultiChannel.volume[index]) && (AUDIO.MultiChannel.channels[i] < AUDIO.MultiChannel.channels[index]))))) index = i;
         }
 
-        index = oldIndex;
+        if (IsAudioBufferPlaying(AUDIO.MultiChannel.pool[index]))
+        {
+            if ((priority < AUDIO.MultiChannel.priority[index]) ||
+                ((priority == AUDIO.MultiChannel.priority[index]) && (volume < AUDIO.MultiChannel.volume[index])))
+            {
+                TRACELOG(LOG_DEBUG, "SOUND: Buffer pool is full, sound not played (priority: %i, volume: %.2f)", priority, volume);
+                return;
+            }
 
-        // Just in case...
-        StopAudioBuffer(AUDIO.MultiChannel.pool[index]);
+            TRACELOG(LOG_DEBUG, "SOUND: Buffer pool is full, channel %i stolen (priority: %i, volume: %.2f)", index, AUDIO.MultiChannel.priority[index], AUDIO.MultiChannel.volume[index]);
+        }
     }
 
-    // Experimentally mutex lock doesn't seem to be needed this makes sense
-    // as pool[index] isn't playing and the only stuff we're copying
-    // shouldn't be changing...
+    AudioBuffer *channel = AUDIO.MultiChannel.pool[index];
 
-    AUDIO.MultiChannel.channels[index] = AUDIO.MultiChannel.poolCounter;
-    AUDIO.MultiChannel.poolCounter++;
+    // NOTE: Sound data and parameters are copied by mixer, a stolen
+    // channel is restarted without being stopped first
+    AudioCommand command = { AUDIO_COMMAND_PLAY, channel, sound.stream.buffer, volume, channel->playCount + 1, pitch };
 
-    AUDIO.MultiChannel.pool[index]->volume = sound.stream.buffer->volume;
-    AUDIO.MultiChannel.pool[index]->pitch = sound.stream.buffer->pitch;
-    AUDIO.MultiChannel.pool[index]->looping = sound.stream.buffer->looping;
-    AUDIO.MultiChannel.pool[index]->usage = sound.stream.buffer->usage;
-    AUDIO.MultiChannel.pool[index]->isSubBufferProcessed[0] = false;
-    AUDIO.MultiChannel.pool[index]->isSubBufferProcessed[1] = false;
-    AUDIO.MultiChannel.pool[index]->sizeInFrames = sound.stream.buffer->sizeInFrames;
-    AUDIO.MultiChannel.pool[index]->data = sound.stream.buffer->data;
+    if (PushAudioCommand(command))
+    {
+        if (AUDIO.MultiChannel.isFree[index])
+        {
+            AUDIO.MultiChannel.isFree[index] = false;
+            AUDIO.MultiChannel.freeCount--;
+        }
+
+        AUDIO.MultiChannel.channels[index] = AUDIO.MultiChannel.poolCounter;
+        AUDIO.MultiChannel.volume[index] = volume;
+        AUDIO.MultiChannel.priority[index] = priority;
+        AUDIO.MultiChannel.poolCounter++;
 
-    PlayAudioBuffer(AUDIO.MultiChannel.pool[index]);
+        channel->playRequested = true;
+        channel->pauseRequested = false;
+        channel->playCount++;
+    }
 }
 
 // Stop any sound played with PlaySoundMulti()
@@ -1011,6 +1333,12 @@ void SetSoundPitch(Sound sound, float pitch)
     SetAudioBufferPitch(sound.stream.buffer, pitch);
 }
 
+// Set pan for a sound
+void SetSoundPan(Sound sound, float pan)
+{
+    SetAudioBufferPan(sound.stream.buffer, pan);
+}
+
 // Convert wave data to desired format
 void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels)
 {
@@ -1284,6 +1612,10 @@ Music LoadMusicStream(const char *fileName)
 // Unload music stream
 void UnloadMusicStream(Music music)
 {
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+    if ((music.stream.buffer != NULL) && (music.stream.buffer->decoder != NULL)) UnloadMusicDecoder(music);
+#endif
+
     CloseAudioStream(music.stream);
 
     if (false) { }
@@ -1307,18 +1639,106 @@ void UnloadMusicStream(Music music)
 #endif
 }
 
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+// Decode music ahead on a background thread, latency is the duration of audio decoded ahead (in seconds)
+// NOTE: Music is restarted, UpdateMusicStream() is not required anymore, decoder is stopped by UnloadMusicStream()
+// Music looping is read at decoder start
+bool StartMusicDecoder(Music music, float latency)
+{
+    if ((music.stream.buffer == NULL) || !AUDIO.System.isReady) return false;
+    if (music.stream.buffer->decoder != NULL) return true;
+
+    StopMusicStream(music);
+
+    MusicDecoder *decoder = (MusicDecoder *)RL_CALLOC(1, sizeof(MusicDecoder));
+    decoder->music = music;
+
+    // Decoded music converted to device format (pitch is applied by mixer)
+    ma_format formatIn = ((music.stream.sampleSize == 8)? ma_format_u8 : ((music.stream.sampleSize == 16)? ma_format_s16 : ma_format_f32));
+    ma_data_converter_config converterConfig = ma_data_converter_config_init(formatIn, AUDIO_DEVICE_FORMAT, music.stream.channels, AUDIO_DEVICE_CHANNELS, music.stream.sampleRate, AUDIO_DEVICE_SAMPLE_RATE);
+
+    if (ma_data_converter_init(&converterConfig, &decoder->converter) != MA_SUCCESS)
+    {
+        TRACELOG(LOG_WARNING, "STREAM: Failed to create music decoder conversion pipeline");
+        RL_FREE(decoder);
+        return false;
+    }
+
+    decoder->chunkFrames = AUDIO.Buffer.defaultSize;
+    if (decoder->chunkFrames == 0) decoder->chunkFrames = DEFAULT_AUDIO_BUFFER_SIZE;
+    decoder->convertedFrames = (unsigned int)ma_data_converter_get_expected_output_frame_count(&decoder->converter, decoder->chunkFrames) + 16;
+    ma_uint32 capacity = (ma_uint32)(latency*AUDIO_DEVICE_SAMPLE_RATE);
+    if (capacity < 2*decoder->convertedFrames) capacity = 2*decoder->convertedFrames;
+
+    // NOTE: Ring buffer index is masked from frame counters, still valid when they wrap around
+    decoder->capacity = 1;
+    while (decoder->capacity < capacity) decoder->capacity *= 2;
+
+    decoder->pcm = RL_CALLOC(decoder->chunkFrames*music.stream.channels, music.stream.sampleSize/8);
+    decoder->converted = (float *)RL_CALLOC(decoder->convertedFrames*AUDIO_DEVICE_CHANNELS, sizeof(float));
+    decoder->frames = (float *)RL_CALLOC(decoder->capacity*AUDIO_DEVICE_CHANNELS, sizeof(float));
+
+    if (ma_thread_create(&decoder->thread, ma_thread_priority_default, 0, MusicDecoderThread, decoder) != MA_SUCCESS)
+    {
+        TRACELOG(LOG_WARNING, "STREAM: Failed to create music decoder thread");
+        ma_data_converter_uninit(&decoder->converter);
+        RL_FREE(decoder->pcm);
+        RL_FREE(decoder->converted);
+        RL_FREE(decoder->frames);
+        RL_FREE(decoder);
+        return false;
+    }
+
+    // Mixer reads frames in device format from decoder
+    AudioBuffer *buffer = music.stream.buffer;
+    ma_data_converter_config bufferConfig = ma_data_converter_config_init(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO_DEVICE_CHANNELS, AUDIO_DEVICE_SAMPLE_RATE, AUDIO_DEVICE_SAMPLE_RATE);
+    bufferConfig.resampling.allowDynamicSampleRate = true;      // Required for pitch shifting
+
+    ma_mutex_lock(&AUDIO.System.lock);
+    {
+        ApplyAudioCommands();
+
+        ma_data_converter_uninit(&buffer->converter);
+        ma_data_converter_init(&bufferConfig, &buffer->converter);
+        ma_data_converter_set_rate(&buffer->converter, AUDIO_DEVICE_SAMPLE_RATE, (ma_uint32)((float)AUDIO_DEVICE_SAMPLE_RATE/buffer->pitch));
+        buffer->decoder = decoder;
+    }
+    ma_mutex_unlock(&AUDIO.System.lock);
+
+    TRACELOG(LOG_INFO, "STREAM: Music decoder started (%i frames decoded ahead)", decoder->capacity);
+
+    return true;
+}
+
+// Stop music decoder thread and unload its data
+// NOTE: Music stream is stopped, its buffer is left in decoder format (music is being unloaded)
+static void UnloadMusicDecoder(Music music)
+{
+    MusicDecoder *decoder = music.stream.buffer->decoder;
+
+    c89atomic_store_explicit_32(&decoder->quit, 1, c89atomic_memory_order_release);
+    ma_thread_wait(&decoder->thread);
+
+    ma_mutex_lock(&AUDIO.System.lock);
+    music.stream.buffer->decoder = NULL;
+    EndAudioBuffer(music.stream.buffer);
+    ma_mutex_unlock(&AUDIO.System.lock);
+
+    ma_data_converter_uninit(&decoder->converter);
+    RL_FREE(decoder->pcm);
+    RL_FREE(decoder->converted);
+    RL_FREE(decoder->frames);
+    RL_FREE(decoder);
+}
+#endif
+
 // Start music playing (open stream)
 void PlayMusicStream(Music music)
 {
     if (music.stream.buffer != NULL)
     {
-        // For music streams, we need to make sure we maintain the frame cursor position
-        // This is a hack for this section of code in UpdateMusicStream()
-        // NOTE: In case window is minimized, music stream is stopped, just make sure to
-        // play again on window restore: if (IsMusicPlaying(music)) PlayMusicStream(music);
-        ma_uint32 frameCursorPos = music.stream.buffer->frameCursorPos;
-        PlayAudioStream(music.stream);  // WARNING: This resets the cursor position.
-        music.stream.buffer->frameCursorPos = frameCursorPos;
+        // NOTE: Stream frame cursor position is maintained by mixer (no restart)
+        PlayAudioStream(music.stream);
     }
 }
 
@@ -1339,28 +1759,17 @@ void StopMusicStream(Music music)
 {
     StopAudioStream(music.stream);
 
-    switch (music.ctxType)
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+    // Music context is owned by decoder thread, restarted there
+    if ((music.stream.buffer != NULL) && (music.stream.buffer->decoder != NULL))
     {
-#if defined(SUPPORT_FILEFORMAT_WAV)
-        case MUSIC_AUDIO_WAV: drwav_seek_to_pcm_frame((drwav *)music.ctxData, 0); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_OGG)
-        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_FLAC)
-        case MUSIC_AUDIO_FLAC: drflac_seek_to_pcm_frame((drflac *)music.ctxData, 0); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MP3)
-        case MUSIC_AUDIO_MP3: drmp3_seek_to_pcm_frame((drmp3 *)music.ctxData, 0); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_XM)
-        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MOD)
-        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
-#endif
-        default: break;
+        MusicDecoder *decoder = music.stream.buffer->decoder;
+        c89atomic_store_explicit_32(&decoder->restartRequested, decoder->restartRequested + 1, c89atomic_memory_order_release);
+        return;
     }
+#endif
+
+    SeekMusicStart(music);
 }
 
 // Update (re-fill) music buffers if data already processed
@@ -1368,12 +1777,27 @@ void UpdateMusicStream(Music music)
 {
     if (music.stream.buffer == NULL) return;
 
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+    if (music.stream.buffer->decoder != NULL) return;   // Decoded ahead by decoder thread
+#endif
+
+    if (!IsAudioStreamProcessed(music.stream)) return;
+
     bool streamEnding = false;
 
     unsigned int subBufferSizeInFrames = music.stream.buffer->sizeInFrames/2;
 
-    // NOTE: Using dynamic allocation because it could require more than 16KB
-    void *pcm = RL_CALLOC(subBufferSizeInFrames*music.stream.channels*music.stream.sampleSize/8, 1);
+    // NOTE: Using dynamic allocation because it could require more than 16KB, reused by next updates
+    unsigned int pcmSize = subBufferSizeInFrames*music.stream.channels*music.stream.sampleSize/8;
+    if (AUDIO.Buffer.musicPcmSize < pcmSize)
+    {
+        RL_FREE(AUDIO.Buffer.musicPcm);
+        AUDIO.Buffer.musicPcm = RL_MALLOC(pcmSize);
+        AUDIO.Buffer.musicPcmSize = pcmSize;
+    }
+
+    void *pcm = AUDIO.Buffer.musicPcm;
+    memset(pcm, 0, pcmSize);
 
     int samplesCount = 0;    // Total size of data streamed in L+R samples for xm floats, individual L or R for ogg shorts
 
@@ -1386,58 +1810,7 @@ void UpdateMusicStream(Music music)
         if ((sampleLeft/music.stream.channels) >= subBufferSizeInFrames) samplesCount = subBufferSizeInFrames*music.stream.channels;
         else samplesCount = sampleLeft;
 
-        switch (music.ctxType)
-        {
-        #if defined(SUPPORT_FILEFORMAT_WAV)
-            case MUSIC_AUDIO_WAV:
-            {
-                // NOTE: Returns the number of samples to process (not required)
-                if (music.stream.sampleSize == 16) drwav_read_pcm_frames_s16((drwav *)music.ctxData, samplesCount/music.stream.channels, (short *)pcm);
-                else if (music.stream.sampleSize == 32) drwav_read_pcm_frames_f32((drwav *)music.ctxData, samplesCount/music.stream.channels, (float *)pcm);
-
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_OGG)
-            case MUSIC_AUDIO_OGG:
-            {
-                // NOTE: Returns the number of samples to process (be careful! we ask for number of shorts!)
-                stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)pcm, samplesCount);
-
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_FLAC)
-            case MUSIC_AUDIO_FLAC:
-            {
-                // NOTE: Returns the number of samples to process (not required)
-                drflac_read_pcm_frames_s16((drflac *)music.ctxData, samplesCount, (short *)pcm);
-
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MP3)
-            case MUSIC_AUDIO_MP3:
-            {
-                // NOTE: samplesCount, actually refers to framesCount and returns the number of frames processed
-                drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, samplesCount/music.stream.channels, (float *)pcm);
-
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_XM)
-            case MUSIC_MODULE_XM:
-            {
-                // NOTE: Internally this function considers 2 channels generation, so samplesCount/2
-                jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)pcm, samplesCount/2);
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MOD)
-            case MUSIC_MODULE_MOD:
-            {
-                // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
-                jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)pcm, samplesCount/2, 0);
-            } break;
-        #endif
-            default: break;
-        }
-
+        ReadMusicSamples(music, pcm, samplesCount);
         UpdateAudioStream(music.stream, pcm, samplesCount);
 
         if ((music.ctxType == MUSIC_MODULE_XM) || (music.ctxType == MUSIC_MODULE_MOD))
@@ -1454,21 +1827,12 @@ void UpdateMusicStream(Music music)
         }
     }
 
-    // Free allocated pcm data
-    RL_FREE(pcm);
-
     // Reset audio stream for looping
     if (streamEnding)
     {
         StopMusicStream(music);                     // Stop music (and reset)
         if (music.looping) PlayMusicStream(music);  // Play again
     }
-    else
-    {
-        // NOTE: In case window is minimized, music stream is stopped,
-        // just make sure to play again on window restore
-        if (IsMusicPlaying(music)) PlayMusicStream(music);
-    }
 }
 
 // Check if any music is playing
@@ -1489,6 +1853,12 @@ void SetMusicPitch(Music music, float pitch)
     SetAudioBufferPitch(music.stream.buffer, pitch);
 }
 
+// Set pan for music
+void SetMusicPan(Music music, float pan)
+{
+    SetAudioBufferPan(music.stream.buffer, pan);
+}
+
 // Get music time length (in seconds)
 float GetMusicTimeLength(Music music)
 {
@@ -1504,6 +1874,20 @@ float GetMusicTimePlayed(Music music)
 {
     float secondsPlayed = 0.0f;
 
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+    // Decoder frames in device format, looping music played several times
+    if ((music.stream.buffer != NULL) && (music.stream.buffer->decoder != NULL))
+    {
+        MusicDecoder *decoder = music.stream.buffer->decoder;
+        secondsPlayed = (float)c89atomic_load_explicit_32(&decoder->framesPlayed, c89atomic_memory_order_acquire)/AUDIO_DEVICE_SAMPLE_RATE;
+
+        float length = GetMusicTimeLength(decoder->music);
+        if (decoder->music.looping && (length > 0.0f)) secondsPlayed = fmodf(secondsPlayed, length);
+
+        return secondsPlayed;
+    }
+#endif
+
     if (music.stream.buffer != NULL)
     {
         //ma_uint32 frameSizeInBytes = ma_get_bytes_per_sample(music.stream.buffer->dsp.formatConverterIn.config.formatIn)*music.stream.buffer->dsp.formatConverterIn.config.channels;
@@ -1559,23 +1943,11 @@ void UpdateAudioStream(AudioStream stream, const void *data, int samplesCount)
 {
     if (stream.buffer != NULL)
     {
-        if (stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1])
-        {
-            ma_uint32 subBufferToUpdate = 0;
-
-            if (stream.buffer->isSubBufferProcessed[0] && stream.buffer->isSubBufferProcessed[1])
-            {
-                // Both buffers are available for updating.
-                // Update the first one and make sure the cursor is moved back to the front.
-                subBufferToUpdate = 0;
-                stream.buffer->frameCursorPos = 0;
-            }
-            else
-            {
-                // Just update whichever sub-buffer is processed.
-                subBufferToUpdate = (stream.buffer->isSubBufferProcessed[0])? 0 : 1;
-            }
+        // NOTE: Sub-buffers are updated in turn, the order mixer plays them
+        ma_uint32 subBufferToUpdate = stream.buffer->subBufferToUpdate;
 
+        if (IsAudioStreamProcessed(stream))
+        {
             ma_uint32 subBufferSizeInFrames = stream.buffer->sizeInFrames/2;
             unsigned char *subBuffer = stream.buffer->data + ((subBufferSizeInFrames*stream.channels*(stream.sampleSize/8))*subBufferToUpdate);
 
@@ -1598,7 +1970,9 @@ void UpdateAudioStream(AudioStream stream, const void *data, int samplesCount)
 
                 if (leftoverFrameCount > 0) memset(subBuffer + bytesToWrite, 0, leftoverFrameCount*stream.channels*(stream.sampleSize/8));
 
-                stream.buffer->isSubBufferProcessed[subBufferToUpdate] = false;
+                // Sub-buffer data is handed over to mixer
+                c89atomic_store_explicit_32(&stream.buffer->isSubBufferProcessed[subBufferToUpdate], 0, c89atomic_memory_order_release);
+                stream.buffer->subBufferToUpdate = (subBufferToUpdate + 1)%2;
             }
             else TRACELOG(LOG_WARNING, "STREAM: Attempting to write too many frames to buffer");
         }
@@ -1611,7 +1985,10 @@ bool IsAudioStreamProcessed(AudioStream stream)
 {
     if (stream.buffer == NULL) return false;
 
-    return (stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1]);
+    // NOTE: Sub-buffers are not available until mixer has applied a pending stop
+    if (c89atomic_load_explicit_32(&stream.buffer->stopPending, c89atomic_memory_order_acquire)) return false;
+
+    return c89atomic_load_explicit_32(&stream.buffer->isSubBufferProcessed[stream.buffer->subBufferToUpdate], c89atomic_memory_order_acquire);
 }
 
 // Play audio stream
@@ -1656,6 +2033,12 @@ void SetAudioStreamPitch(AudioStream stream, float pitch)
     SetAudioBufferPitch(stream.buffer, pitch);
 }
 
+// Set pan for audio stream (0.5 is center)
+void SetAudioStreamPan(AudioStream stream, float pan)
+{
+    SetAudioBufferPan(stream.buffer, pan);
+}
+
 // Default size for new audio streams
 void SetAudioStreamBufferSizeDefault(int size)
 {
@@ -1678,6 +2061,10 @@ static void OnLog(ma_context *pContext, ma_device *pDevice, ma_uint32 logLevel,
 // Reads audio data from an AudioBuffer object in internal format.
 static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount)
 {
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+    if (audioBuffer->decoder != NULL) return ReadMusicDecoderFrames(audioBuffer, (float *)framesOut, frameCount);
+#endif
+
     ma_uint32 subBufferSizeInFrames = (audioBuffer->sizeInFrames > 1)? audioBuffer->sizeInFrames/2 : audioBuffer->sizeInFrames;
     ma_uint32 currentSubBufferIndex = audioBuffer->frameCursorPos/subBufferSizeInFrames;
 
@@ -1686,8 +2073,8 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
     // Another thread can update the processed state of buffers so
     // we just take a copy here to try and avoid potential synchronization problems
     bool isSubBufferProcessed[2];
-    isSubBufferProcessed[0] = audioBuffer->isSubBufferProcessed[0];
-    isSubBufferProcessed[1] = audioBuffer->isSubBufferProcessed[1];
+    isSubBufferProcessed[0] = c89atomic_load_explicit_32(&audioBuffer->isSubBufferProcessed[0], c89atomic_memory_order_acquire);
+    isSubBufferProcessed[1] = c89atomic_load_explicit_32(&audioBuffer->isSubBufferProcessed[1], c89atomic_memory_order_acquire);
 
     ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(audioBuffer->converter.config.formatIn, audioBuffer->converter.config.channelsIn);
 
@@ -1732,7 +2119,7 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
         // If we've read to the end of the buffer, mark it as processed
         if (framesToRead == framesRemainingInOutputBuffer)
         {
-            audioBuffer->isSubBufferProcessed[currentSubBufferIndex] = true;
+            c89atomic_store_explicit_32(&audioBuffer->isSubBufferProcessed[currentSubBufferIndex], 1, c89atomic_memory_order_release);
             isSubBufferProcessed[currentSubBufferIndex] = true;
 
             currentSubBufferIndex = (currentSubBufferIndex + 1)%2;
@@ -1740,7 +2127,7 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
             // We need to break from this loop if we're not looping
             if (!audioBuffer->looping)
             {
-                StopAudioBuffer(audioBuffer);
+                EndAudioBuffer(audioBuffer);
                 break;
             }
         }
@@ -1768,6 +2155,14 @@ static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, f
     // should be defined by the output format of the data converter. We do this until frameCount frames have been output. The important
     // detail to remember here is that we never, ever attempt to read more input data than is required for the specified number of output
     // frames. This can be achieved with ma_data_converter_get_required_input_frame_count().
+    // Data already in mixing format, no resampling: read directly (no conversion copy)
+    if ((audioBuffer->converter.config.formatIn == ma_format_f32) && (audioBuffer->pitch == 1.0f) &&
+        (audioBuffer->converter.config.channelsIn == audioBuffer->converter.config.channelsOut) &&
+        (audioBuffer->converter.config.sampleRateIn == audioBuffer->converter.config.sampleRateOut))
+    {
+        return ReadAudioBufferFramesInInternalFormat(audioBuffer, framesOut, frameCount);
+    }
+
     ma_uint8 inputBuffer[4096];
     ma_uint32 inputBufferFrameCap = sizeof(inputBuffer)/ma_get_bytes_per_frame(audioBuffer->converter.config.formatIn, audioBuffer->converter.config.channelsIn);
 
@@ -1813,13 +2208,17 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
 {
     (void)pDevice;
 
+    double mixingStart = ma_timer_get_time_in_seconds(&AUDIO.System.timer);
+
     // Mixing is basically just an accumulation, we need to initialize the output buffer to 0
     memset(pFramesOut, 0, frameCount*pDevice->playback.channels*ma_get_bytes_per_sample(pDevice->playback.format));
 
-    // Using a mutex here for thread-safety which makes things not real-time
-    // This is unlikely to be necessary for this project, but may want to consider how you might want to avoid this
+    // NOTE: Playback changes are received as audio commands, mutex is only locked
+    // by user thread to load/unload audio buffers (not while playing them)
     ma_mutex_lock(&AUDIO.System.lock);
     {
+        ApplyAudioCommands();
+
         for (AudioBuffer *audioBuffer = AUDIO.Buffer.first; audioBuffer != NULL; audioBuffer = audioBuffer->next)
         {
             // Ignore stopped or paused sounds
@@ -1850,7 +2249,7 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
                         float *framesOut = (float *)pFramesOut + (framesRead*AUDIO.System.device.playback.channels);
                         float *framesIn  = tempBuffer;
 
-                        MixAudioFrames(framesOut, framesIn, framesJustRead, audioBuffer->volume);
+                        MixAudioFrames(framesOut, framesIn, framesJustRead, audioBuffer);
 
                         framesToRead -= framesJustRead;
                         framesRead += framesJustRead;
@@ -1867,7 +2266,7 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
                     {
                         if (!audioBuffer->looping)
                         {
-                            StopAudioBuffer(audioBuffer);
+                            EndAudioBuffer(audioBuffer);
                             break;
                         }
                         else
@@ -1888,24 +2287,447 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
     }
 
     ma_mutex_unlock(&AUDIO.System.lock);
+
+    // Mixed sounds could exceed output range
+    ClampAudioSamples((float *)pFramesOut, frameCount*pDevice->playback.channels);
+
+    // Mixing time measured for GetAudioMixingLoad()
+    AUDIO.System.mixingTime += ma_timer_get_time_in_seconds(&AUDIO.System.timer) - mixingStart;
+    c89atomic_store_explicit_32(&AUDIO.System.mixingMicroseconds, (ma_uint32)(ma_uint64)(AUDIO.System.mixingTime*1000000.0), c89atomic_memory_order_release);
+    c89atomic_store_explicit_32(&AUDIO.System.mixedFrames, AUDIO.System.mixedFrames + frameCount, c89atomic_memory_order_release);
 }
 
 // This is the main mixing function. Mixing is pretty simple in this project - it's just an accumulation.
 // NOTE: framesOut is both an input and an output. It will be initially filled with zeros outside of this function.
-static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, float localVolume)
+static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer)
+{
+    ma_uint32 channels = AUDIO.System.device.playback.channels;
+    float volume = buffer->volume*AUDIO.System.masterVolume;
+    float gains[MA_MAX_CHANNELS] = { 0 };
+
+    // Stereo balance: center pan keeps both channels at full volume
+    for (ma_uint32 iChannel = 0; iChannel < channels; iChannel++) gains[iChannel] = volume;
+
+    if (channels == 2)
+    {
+        if (buffer->pan < 0.5f) gains[1] = volume*2.0f*buffer->pan;
+        else gains[0] = volume*2.0f*(1.0f - buffer->pan);
+    }
+
+    MixAudioSamples(framesOut, framesIn, frameCount*channels, gains, channels);
+}
+
+// Mixing kernel: accumulate interleaved samples with a gain per channel
+// NOTE: SIMD kernels require channels to divide vector width (mono, stereo or quad), scalar code is used otherwise
+void MixAudioSamples(float *samplesOut, const float *samplesIn, unsigned int sampleCount, const float *gains, unsigned int channels)
+{
+    ma_uint32 i = 0;
+
+#if defined(AUDIO_MIXING_SSE) || defined(AUDIO_MIXING_AVX) || defined(AUDIO_MIXING_NEON)
+    if (audioMixingSimd && ((channels == 1) || (channels == 2) || (channels == 4)))
+    {
+        // Gains pattern repeated over vector width
+        float pattern[8] = { 0 };
+        for (int k = 0; k < 8; k++) pattern[k] = gains[k%channels];
+
+    #if defined(AUDIO_MIXING_AVX)
+        __m256 gain8 = _mm256_loadu_ps(pattern);
+        for (; i + 8 <= sampleCount; i += 8) _mm256_storeu_ps(samplesOut + i, _mm256_add_ps(_mm256_loadu_ps(samplesOut + i), _mm256_mul_ps(_mm256_loadu_ps(samplesIn + i), gain8)));
+    #endif
+    #if defined(AUDIO_MIXING_SSE)
+        __m128 gain4 = _mm_loadu_ps(pattern);
+        for (; i + 4 <= sampleCount; i += 4) _mm_storeu_ps(samplesOut + i, _mm_add_ps(_mm_loadu_ps(samplesOut + i), _mm_mul_ps(_mm_loadu_ps(samplesIn + i), gain4)));
+    #elif defined(AUDIO_MIXING_NEON)
+        float32x4_t gain4 = vld1q_f32(pattern);
+        for (; i + 4 <= sampleCount; i += 4) vst1q_f32(samplesOut + i, vmlaq_f32(vld1q_f32(samplesOut + i), vld1q_f32(samplesIn + i), gain4));
+    #endif
+    }
+#endif
+
+    for (; i < sampleCount; i++) samplesOut[i] += samplesIn[i]*gains[i%channels];
+}
+
+// Clamp samples to output range [-1.0..1.0]
+void ClampAudioSamples(float *samples, unsigned int sampleCount)
+{
+    ma_uint32 i = 0;
+
+#if defined(AUDIO_MIXING_SSE) || defined(AUDIO_MIXING_AVX) || defined(AUDIO_MIXING_NEON)
+    if (audioMixingSimd)
+    {
+    #if defined(AUDIO_MIXING_AVX)
+        __m256 min8 = _mm256_set1_ps(-1.0f), max8 = _mm256_set1_ps(1.0f);
+        for (; i + 8 <= sampleCount; i += 8) _mm256_storeu_ps(samples + i, _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(samples + i), min8), max8));
+    #endif
+    #if defined(AUDIO_MIXING_SSE)
+        __m128 min4 = _mm_set1_ps(-1.0f), max4 = _mm_set1_ps(1.0f);
+        for (; i + 4 <= sampleCount; i += 4) _mm_storeu_ps(samples + i, _mm_min_ps(_mm_max_ps(_mm_loadu_ps(samples + i), min4), max4));
+    #elif defined(AUDIO_MIXING_NEON)
+        float32x4_t min4 = vdupq_n_f32(-1.0f), max4 = vdupq_n_f32(1.0f);
+        for (; i + 4 <= sampleCount; i += 4) vst1q_f32(samples + i, vminq_f32(vmaxq_f32(vld1q_f32(samples + i), min4), max4));
+    #endif
+    }
+#endif
+
+    for (; i < sampleCount; i++) samples[i] = (samples[i] < -1.0f)? -1.0f : ((samples[i] > 1.0f)? 1.0f : samples[i]);
+}
+
+// Push audio command to mixer, applied before next mixing
+// NOTE: Single producer (user thread): commands are pushed without lock, never waiting for mixer
+static bool PushAudioCommand(AudioCommand command)
 {
-    for (ma_uint32 iFrame = 0; iFrame < frameCount; ++iFrame)
+    // No mixer running, command can be applied right away
+    if (!AUDIO.System.isReady)
+    {
+        ApplyAudioCommand(&command);
+        return true;
+    }
+
+    ma_uint32 pushed = c89atomic_load_explicit_32(&AUDIO.Command.pushed, c89atomic_memory_order_relaxed);
+    ma_uint32 applied = c89atomic_load_explicit_32(&AUDIO.Command.applied, c89atomic_memory_order_acquire);
+
+    if ((pushed - applied) >= MAX_AUDIO_COMMANDS)
     {
-        for (ma_uint32 iChannel = 0; iChannel < AUDIO.System.device.playback.channels; ++iChannel)
+        TRACELOG(LOG_WARNING, "AUDIO: Commands queue is full (%i commands), command discarded", MAX_AUDIO_COMMANDS);
+        return false;
+    }
+
+    AUDIO.Command.queue[pushed%MAX_AUDIO_COMMANDS] = command;
+    c89atomic_store_explicit_32(&AUDIO.Command.pushed, pushed + 1, c89atomic_memory_order_release);
+
+    return true;
+}
+
+// Apply audio command (mixer)
+static void ApplyAudioCommand(const AudioCommand *command)
+{
+    AudioBuffer *buffer = command->buffer;
+
+    switch (command->type)
+    {
+        case AUDIO_COMMAND_PLAY:
         {
-            float *frameOut = framesOut + (iFrame*AUDIO.System.device.playback.channels);
-            const float *frameIn  = framesIn  + (iFrame*AUDIO.System.device.playback.channels);
+            if (command->source != NULL)
+            {
+                // Multichannel pool buffer plays a copy of source buffer
+                buffer->volume = command->source->volume*command->value;
+                buffer->pitch = command->source->pitch*command->pitch;
+                buffer->pan = command->source->pan;
+                buffer->looping = command->source->looping;
+                buffer->sizeInFrames = command->source->sizeInFrames;
+                buffer->data = command->source->data;
+                ma_data_converter_set_rate(&buffer->converter, buffer->converter.config.sampleRateIn, (ma_uint32)((float)buffer->converter.config.sampleRateOut/buffer->pitch));
+            }
+
+            // NOTE: Streams keep their frame cursor position, sub-buffers are played in turn
+            if (buffer->usage == AUDIO_BUFFER_USAGE_STATIC) buffer->frameCursorPos = 0;
+
+            buffer->playing = true;
+            buffer->paused = false;
+            buffer->mixerPlayCount = command->playCount;
+        } break;
+        case AUDIO_COMMAND_STOP:
+        {
+            // NOTE: Sub-buffers stay unavailable while another stop is still queued
+            EndAudioBuffer(buffer);
+            c89atomic_fetch_sub_explicit_32(&buffer->stopPending, 1, c89atomic_memory_order_release);
+        } break;
+        case AUDIO_COMMAND_PAUSE: buffer->paused = true; break;
+        case AUDIO_COMMAND_RESUME: buffer->paused = false; break;
+        case AUDIO_COMMAND_VOLUME: buffer->volume = command->value; break;
+        case AUDIO_COMMAND_PITCH:
+        {
+            // Pitching is just an adjustment of the sample rate.
+            // Note that this changes the duration of the sound:
+            //  - higher pitches will make the sound faster
+            //  - lower pitches make it slower
+            ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.config.sampleRateOut/command->value);
+            ma_data_converter_set_rate(&buffer->converter, buffer->converter.config.sampleRateIn, outputSampleRate);
+
+            buffer->pitch = command->value;
+        } break;
+        case AUDIO_COMMAND_PAN: buffer->pan = command->value; break;
+        case AUDIO_COMMAND_MASTER_VOLUME: AUDIO.System.masterVolume = command->value; break;
+        default: break;
+    }
+}
 
-            frameOut[iChannel] += (frameIn[iChannel]*localVolume);
+// Apply pushed audio commands
+// NOTE: Single consumer: mixer or user thread, holding the lock
+static void ApplyAudioCommands(void)
+{
+    ma_uint32 applied = c89atomic_load_explicit_32(&AUDIO.Command.applied, c89atomic_memory_order_relaxed);
+    ma_uint32 pushed = c89atomic_load_explicit_32(&AUDIO.Command.pushed, c89atomic_memory_order_acquire);
+
+    for (; applied != pushed; applied++) ApplyAudioCommand(&AUDIO.Command.queue[applied%MAX_AUDIO_COMMANDS]);
+
+    c89atomic_store_explicit_32(&AUDIO.Command.applied, applied, c89atomic_memory_order_release);
+}
+
+// Stop audio buffer (mixer), reported to user
+// NOTE: Stream is reset, all sub-buffers available for updating
+static void EndAudioBuffer(AudioBuffer *buffer)
+{
+    // Ended multichannel pool channel is reported to user (free list)
+    if (buffer->playing && (buffer->poolIndex >= 0))
+    {
+        ma_uint32 endedPushed = c89atomic_load_explicit_32(&AUDIO.MultiChannel.endedPushed, c89atomic_memory_order_relaxed);
+        ma_uint32 endedPopped = c89atomic_load_explicit_32(&AUDIO.MultiChannel.endedPopped, c89atomic_memory_order_acquire);
+
+        // NOTE: If full (stolen channels), channel is found ended when looking for a channel to steal
+        if ((endedPushed - endedPopped) < MAX_AUDIO_BUFFER_POOL_CHANNELS)
+        {
+            AUDIO.MultiChannel.ended[endedPushed%MAX_AUDIO_BUFFER_POOL_CHANNELS] = buffer->poolIndex;
+            c89atomic_store_explicit_32(&AUDIO.MultiChannel.endedPushed, endedPushed + 1, c89atomic_memory_order_release);
         }
     }
+
+    buffer->playing = false;
+    buffer->paused = false;
+    buffer->frameCursorPos = 0;
+
+    c89atomic_store_explicit_32(&buffer->isSubBufferProcessed[0], 1, c89atomic_memory_order_release);
+    c89atomic_store_explicit_32(&buffer->isSubBufferProcessed[1], 1, c89atomic_memory_order_release);
+    c89atomic_store_explicit_32(&buffer->endedPlayCount, buffer->mixerPlayCount, c89atomic_memory_order_release);
 }
 
+// Seek music to its start
+static void SeekMusicStart(Music music)
+{
+    switch (music.ctxType)
+    {
+#if defined(SUPPORT_FILEFORMAT_WAV)
+        case MUSIC_AUDIO_WAV: drwav_seek_to_pcm_frame((drwav *)music.ctxData, 0); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC: drflac_seek_to_pcm_frame((drflac *)music.ctxData, 0); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3: drmp3_seek_to_pcm_frame((drmp3 *)music.ctxData, 0); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
+#endif
+        default: break;
+    }
+}
+
+// Read music samples from its current position
+static void ReadMusicSamples(Music music, void *pcm, int samplesCount)
+{
+    switch (music.ctxType)
+    {
+    #if defined(SUPPORT_FILEFORMAT_WAV)
+        case MUSIC_AUDIO_WAV:
+        {
+            // NOTE: Returns the number of samples to process (not required)
+            if (music.stream.sampleSize == 16) drwav_read_pcm_frames_s16((drwav *)music.ctxData, samplesCount/music.stream.channels, (short *)pcm);
+            else if (music.stream.sampleSize == 32) drwav_read_pcm_frames_f32((drwav *)music.ctxData, samplesCount/music.stream.channels, (float *)pcm);
+
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG:
+        {
+            // NOTE: Returns the number of samples to process (be careful! we ask for number of shorts!)
+            stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)pcm, samplesCount);
+
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC:
+        {
+            // NOTE: Returns the number of samples to process (not required)
+            drflac_read_pcm_frames_s16((drflac *)music.ctxData, samplesCount, (short *)pcm);
+
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3:
+        {
+            // NOTE: samplesCount, actually refers to framesCount and returns the number of frames processed
+            drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, samplesCount/music.stream.channels, (float *)pcm);
+
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM:
+        {
+            // NOTE: Internally this function considers 2 channels generation, so samplesCount/2
+            jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)pcm, samplesCount/2);
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD:
+        {
+            // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
+            jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)pcm, samplesCount/2, 0);
+        } break;
+    #endif
+        default: break;
+    }
+}
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+// Music decoder thread: decodes music ahead while frames ring buffer has room for a decoded chunk
+static ma_thread_result MA_THREADCALL MusicDecoderThread(void *data)
+{
+    MusicDecoder *decoder = (MusicDecoder *)data;
+    Music music = decoder->music;
+    ma_uint32 frameSize = AUDIO_DEVICE_CHANNELS;
+    ma_uint32 restartDone = 0;
+    int sampleLeft = music.sampleCount;
+
+    while (!c89atomic_load_explicit_32(&decoder->quit, c89atomic_memory_order_acquire))
+    {
+        ma_uint32 written = decoder->written;
+
+        // Restart requested by user: music decoded again from start, previous frames are skipped by mixer
+        ma_uint32 restartRequested = c89atomic_load_explicit_32(&decoder->restartRequested, c89atomic_memory_order_acquire);
+        if (restartRequested != restartDone)
+        {
+            SeekMusicStart(music);
+            sampleLeft = music.sampleCount;
+            restartDone = restartRequested;
+
+            c89atomic_store_explicit_32(&decoder->ended, 0, c89atomic_memory_order_relaxed);
+            c89atomic_store_explicit_32(&decoder->restartFrame, written, c89atomic_memory_order_relaxed);
+            c89atomic_store_explicit_32(&decoder->restartDone, restartDone, c89atomic_memory_order_release);
+        }
+
+        ma_uint32 read = c89atomic_load_explicit_32(&decoder->read, c89atomic_memory_order_acquire);
+
+        // Waiting for room or for the end of music to be played
+        if (c89atomic_load_explicit_32(&decoder->ended, c89atomic_memory_order_acquire) || ((decoder->capacity - (written - read)) < decoder->convertedFrames))
+        {
+            ma_sleep(MUSIC_DECODER_SLEEP_TIME);
+            continue;
+        }
+
+        int samplesCount = decoder->chunkFrames*music.stream.channels;
+        if (sampleLeft < samplesCount) samplesCount = sampleLeft;
+
+        ReadMusicSamples(music, decoder->pcm, samplesCount);
+
+        if ((music.ctxType == MUSIC_MODULE_XM) || (music.ctxType == MUSIC_MODULE_MOD))
+        {
+            if (samplesCount > 1) sampleLeft -= samplesCount/2;
+            else sampleLeft -= samplesCount;
+        }
+        else sampleLeft -= samplesCount;
+
+        // Converted frames copied to ring buffer, room checked for a whole chunk
+        ma_uint64 framesIn = samplesCount/music.stream.channels;
+        ma_uint64 framesOut = decoder->convertedFrames;
+        ma_data_converter_process_pcm_frames(&decoder->converter, decoder->pcm, &framesIn, decoder->converted, &framesOut);
+
+        if (framesIn < (ma_uint64)(samplesCount/music.stream.channels)) TRACELOG(LOG_WARNING, "STREAM: Music decoder chunk not fully converted (%i frames)", (int)framesIn);
+
+        ma_uint32 start = written & (decoder->capacity - 1);
+        ma_uint32 firstPart = ((start + (ma_uint32)framesOut) > decoder->capacity)? decoder->capacity - start : (ma_uint32)framesOut;
+
+        memcpy(decoder->frames + start*frameSize, decoder->converted, firstPart*frameSize*sizeof(float));
+        memcpy(decoder->frames, decoder->converted + firstPart*frameSize, ((ma_uint32)framesOut - firstPart)*frameSize*sizeof(float));
+
+        c89atomic_store_explicit_32(&decoder->written, written + (ma_uint32)framesOut, c89atomic_memory_order_release);
+
+        // End of music: decoded again from start if looping, otherwise once its end has been played
+        if (sampleLeft <= 0)
+        {
+            SeekMusicStart(music);
+            sampleLeft = music.sampleCount;
+
+            if (!music.looping) c89atomic_store_explicit_32(&decoder->ended, 1, c89atomic_memory_order_release);
+        }
+
+    }
+
+    return (ma_thread_result)0;
+}
+
+// Read music decoded ahead (mixer)
+// NOTE: Missing frames (decoder late) are played as silence, music is ended once decoder end frames are played
+static ma_uint32 ReadMusicDecoderFrames(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount)
+{
+    MusicDecoder *decoder = audioBuffer->decoder;
+    ma_uint32 frameSize = AUDIO_DEVICE_CHANNELS;
+    ma_uint32 framesRead = 0;
+
+    // Offline rendering is not real time: mixer waits for decoder instead of playing silence
+    if (AUDIO.System.isOffline) WaitMusicDecoderFrames(decoder, frameCount);
+
+    ma_uint32 restartDone = c89atomic_load_explicit_32(&decoder->restartDone, c89atomic_memory_order_acquire);
+
+    // Waiting for a requested restart
+    if (restartDone == c89atomic_load_explicit_32(&decoder->restartRequested, c89atomic_memory_order_acquire))
+    {
+        ma_uint32 read = decoder->read;
+
+        // Frames decoded before restart are skipped
+        if (restartDone != decoder->restartApplied)
+        {
+            read = c89atomic_load_explicit_32(&decoder->restartFrame, c89atomic_memory_order_relaxed);
+            decoder->restartApplied = restartDone;
+            c89atomic_store_explicit_32(&decoder->framesPlayed, 0, c89atomic_memory_order_release);
+        }
+
+        // NOTE: Ended read first, all end frames are then available
+        ma_uint32 ended = c89atomic_load_explicit_32(&decoder->ended, c89atomic_memory_order_acquire);
+        ma_uint32 available = c89atomic_load_explicit_32(&decoder->written, c89atomic_memory_order_acquire) - read;
+        framesRead = (available < frameCount)? available : frameCount;
+
+        ma_uint32 start = read & (decoder->capacity - 1);
+        ma_uint32 firstPart = ((start + framesRead) > decoder->capacity)? decoder->capacity - start : framesRead;
+
+        memcpy(framesOut, decoder->frames + start*frameSize, firstPart*frameSize*sizeof(float));
+        memcpy(framesOut + firstPart*frameSize, decoder->frames, (framesRead - firstPart)*frameSize*sizeof(float));
+
+        c89atomic_store_explicit_32(&decoder->read, read + framesRead, c89atomic_memory_order_release);
+        c89atomic_store_explicit_32(&decoder->framesPlayed, decoder->framesPlayed + framesRead, c89atomic_memory_order_release);
+
+        // Music end played (stream buffers always loop): decoder continues from start
+        if ((framesRead == available) && ended)
+        {
+            EndAudioBuffer(audioBuffer);
+            c89atomic_store_explicit_32(&decoder->framesPlayed, 0, c89atomic_memory_order_release);
+            c89atomic_store_explicit_32(&decoder->ended, 0, c89atomic_memory_order_release);
+
+            return framesRead;
+        }
+    }
+
+    if (framesRead < frameCount) memset(framesOut + framesRead*frameSize, 0, (frameCount - framesRead)*frameSize*sizeof(float));
+
+    return frameCount;
+}
+
+// Wait for frames decoded ahead (offline mixer), until frameCount frames or music end are available
+// NOTE: Frames ring buffer holds at least two decoded chunks, decoder has room while mixer waits
+static void WaitMusicDecoderFrames(MusicDecoder *decoder, ma_uint32 frameCount)
+{
+    while (true)
+    {
+        ma_uint32 restartDone = c89atomic_load_explicit_32(&decoder->restartDone, c89atomic_memory_order_acquire);
+
+        if (restartDone == c89atomic_load_explicit_32(&decoder->restartRequested, c89atomic_memory_order_acquire))
+        {
+            // Frames decoded before restart are released first, decoder could be waiting for room
+            if (restartDone != decoder->restartApplied) c89atomic_store_explicit_32(&decoder->read, c89atomic_load_explicit_32(&decoder->restartFrame, c89atomic_memory_order_relaxed), c89atomic_memory_order_release);
+
+            if (c89atomic_load_explicit_32(&decoder->ended, c89atomic_memory_order_acquire) ||
+                ((c89atomic_load_explicit_32(&decoder->written, c89atomic_memory_order_acquire) - decoder->read) >= frameCount)) return;
+        }
+
+        ma_sleep(1);
+    }
+}
+#endif
+
 // Initialise the multichannel buffer pool
 static void InitAudioBufferPool(void)
 {
@@ -1914,8 +2736,17 @@ static void InitAudioBufferPool(void)
     {
         // WARNING: An empty audioBuffer is created (data = 0)
         AUDIO.MultiChannel.pool[i] = LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO_DEVICE_SAMPLE_RATE, 0, AUDIO_BUFFER_USAGE_STATIC);
+        AUDIO.MultiChannel.pool[i]->poolIndex = i;
+
+        // Free list is popped from first channel
+        AUDIO.MultiChannel.isFree[i] = true;
+        AUDIO.MultiChannel.freeList[i] = MAX_AUDIO_BUFFER_POOL_CHANNELS - 1 - i;
     }
 
+    AUDIO.MultiChannel.freeCount = MAX_AUDIO_BUFFER_POOL_CHANNELS;
+    AUDIO.MultiChannel.endedPushed = 0;
+    AUDIO.MultiChannel.endedPopped = 0;
+
     // TODO: Verification required for log
     TRACELOG(LOG_INFO, "AUDIO: Multichannel pool size: %i", MAX_AUDIO_BUFFER_POOL_CHANNELS);
 }
@@ -1961,7 +2792,7 @@ static int SaveWAV(Wave wave, const char *fileName)
     drwav wav = { 0 };
     drwav_data_format format = { 0 };
     format.container = drwav_container_riff;
-    format.format = DR_WAVE_FORMAT_PCM;
+    format.format = (wave.sampleSize == 32)? DR_WAVE_FORMAT_IEEE_FLOAT : DR_WAVE_FORMAT_PCM;   // 32bit samples are float
     format.channels = wave.channels;
     format.sampleRate = wave.sampleRate;
     format.bitsPerSample = wave.sampleSize;
@@ -272,6 +272,8 @@ typedef struct CharInfo {
     Image image;            // Character image data
 } CharInfo;
 
+typedef struct rFontAtlas rFontAtlas;
+
 // Font type, includes texture and charSet array data
 typedef struct Font {
     int baseSize;           // Base size (default chars height)
@@ -280,10 +282,21 @@ typedef struct Font {
     Texture2D texture;      // Characters texture atlas
     Rectangle *recs;        // Characters rectangles in texture
     CharInfo *chars;        // Characters info data
+    int *glyphIndex;        // Characters lookup index by codepoint (NULL: linear search)
+    rFontAtlas *atlas;      // Dynamic glyphs atlas, characters loaded on first use (NULL: all characters loaded)
 } Font;
 
 #define SpriteFont Font     // SpriteFont type fallback, defaults to Font
 
+// Text layout type, glyph quads of a text computed once (LoadTextLayout())
+typedef struct TextLayout {
+    Texture2D texture;      // Font texture atlas (not owned)
+    int quadsCount;         // Number of glyph quads
+    Rectangle *sources;     // Glyph quads texture coordinates (normalized)
+    Rectangle *dests;       // Glyph quads rectangles, relative to text position
+    Vector2 size;           // Text size (as MeasureTextEx())
+} TextLayout;
+
 // Camera type, defines a camera position/orientation in 3d space
 typedef struct Camera3D {
     Vector3 position;       // Camera position
@@ -444,6 +457,15 @@ typedef struct Music {
     void *ctxData;                  // Audio context data, depends on type
 } Music;
 
+// Asset pack type, files packed together in a single file (ExportAssetPack())
+// NOTE: Pack is memory mapped if supported by platform, packed files data is read in place
+typedef struct AssetPack {
+    unsigned char *data;            // Pack file data (memory mapped or loaded)
+    unsigned int dataSize;          // Pack file size (bytes)
+    int filesCount;                 // Number of packed files
+    bool mapped;                    // Pack file is memory mapped (otherwise loaded in memory)
+} AssetPack;
+
 // Head-Mounted-Display device parameters
 typedef struct VrDeviceInfo {
     int hResolution;                // HMD horizontal resolution in pixels
@@ -787,6 +809,13 @@ typedef enum {
     COMPRESSED_ASTC_8x8_RGBA        // 2 bpp
 } PixelFormat;
 
+// Image compression quality (DXT formats encoding speed)
+typedef enum {
+    COMPRESSION_FAST = 0,           // Bounding box endpoints
+    COMPRESSION_NORMAL,             // Principal axis endpoints, refined once
+    COMPRESSION_HIGH                // Principal axis endpoints, refined multiple times
+} CompressionQuality;
+
 // Texture parameters: filter mode
 // NOTE 1: Filtering considers mipmaps if available in the texture
 // NOTE 2: Filter is accordingly set for minification and magnification
@@ -874,6 +903,7 @@ typedef enum {
 
 // Callbacks to be implemented by users
 typedef void (*TraceLogCallback)(int logType, const char *text, va_list args);
+typedef void (*ScreenshotCallback)(const char *fileName, bool success);
 
 #if defined(__cplusplus)
 extern "C" {            // Prevents name mangling of functions
@@ -899,6 +929,7 @@ RLAPI bool IsWindowMinimized(void);                               // Check if wi
 RLAPI bool IsWindowMaximized(void);                               // Check if window is currently maximized (only PLATFORM_DESKTOP)
 RLAPI bool IsWindowFocused(void);                                 // Check if window is currently focused (only PLATFORM_DESKTOP)
 RLAPI bool IsWindowResized(void);                                 // Check if window has been resized last frame
+RLAPI bool IsWindowHeadless(void);                                // Check if window is rendering offscreen, without display (headless OSMesa)
 RLAPI bool IsWindowState(unsigned int flag);                      // Check if one specific window flag is enabled
 RLAPI void SetWindowState(unsigned int flags);                    // Set window configuration state using flags
 RLAPI void ClearWindowState(unsigned int flags);                  // Clear window configuration state flags
@@ -963,6 +994,7 @@ RLAPI Vector2 GetScreenToWorld2D(Vector2 position, Camera2D camera); // Returns
 RLAPI void SetTargetFPS(int fps);                                 // Set target FPS (maximum)
 RLAPI int GetFPS(void);                                           // Returns current FPS
 RLAPI float GetFrameTime(void);                                   // Returns time in seconds for last frame drawn
+RLAPI float GetFrameWorkTime(void);                               // Returns time in seconds for last frame update and draw (target FPS wait excluded)
 RLAPI double GetTime(void);                                       // Returns elapsed time in seconds since InitWindow()
 
 // Misc. functions
@@ -976,6 +1008,13 @@ RLAPI void TraceLog(int logType, const char *text, ...);          // Show trace
 RLAPI void *MemAlloc(int size);                                   // Internal memory allocator
 RLAPI void MemFree(void *ptr);                                    // Internal memory free
 RLAPI void TakeScreenshot(const char *fileName);                  // Takes a screenshot of current screen (saved a .png)
+RLAPI bool TakeScreenshotAsync(const char *fileName);             // Takes a screenshot of current screen, saved on a background thread (returns false if skipped)
+RLAPI void SetScreenshotCallback(ScreenshotCallback callback);    // Set async screenshots completion callback (called from EndDrawing())
+RLAPI int GetScreenshotsPending(void);                            // Get number of async screenshots not saved yet
+RLAPI void BeginScreenRecording(const char *fileName);            // Begin screen recording (.gif or .y4m raw video), encoded on a background thread
+RLAPI void EndScreenRecording(void);                              // End screen recording, waits for pending frames and saves file
+RLAPI bool IsScreenRecording(void);                               // Check if screen is being recorded
+RLAPI int GetScreenRecordingDroppedFrames(void);                  // Get number of frames dropped by current (or last) screen recording
 RLAPI int GetRandomValue(int min, int max);                       // Returns a random value between min and max (both included)
 
 // Files management functions
@@ -985,6 +1024,10 @@ RLAPI bool SaveFileData(const char *fileName, void *data, unsigned int bytesToWr
 RLAPI char *LoadFileText(const char *fileName);                   // Load text data from file (read), returns a '\0' terminated string
 RLAPI void UnloadFileText(unsigned char *text);                   // Unload file text data allocated by LoadFileText()
 RLAPI bool SaveFileText(const char *fileName, char *text);        // Save text data to file (write), string must be '\0' terminated, returns true on success
+RLAPI AssetPack LoadAssetPack(const char *fileName);              // Load asset pack file (memory mapped if supported)
+RLAPI void UnloadAssetPack(AssetPack pack);                        // Unload asset pack, packed files data not valid anymore
+RLAPI const unsigned char *GetAssetPackFileData(AssetPack pack, const char *fileName, unsigned int *dataSize); // Get packed file data, read in place (no copy), NULL if not packed
+RLAPI bool ExportAssetPack(const char *dirPath, const char *fileName); // Export directory files (recursively) as an asset pack, returns true on success
 RLAPI bool FileExists(const char *fileName);                      // Check if file exists
 RLAPI bool DirectoryExists(const char *dirPath);                  // Check if a directory path exists
 RLAPI bool IsFileExtension(const char *fileName, const char *ext);// Check file extension (including point: .png, .wav)
@@ -1161,6 +1204,8 @@ RLAPI Image ImageFromImage(Image image, Rectangle rec);
 RLAPI Image ImageText(const char *text, int fontSize, Color color);                                      // Create an image from text (default font)
 RLAPI Image ImageTextEx(Font font, const char *text, float fontSize, float spacing, Color tint);         // Create an image from text (custom sprite font)
 RLAPI void ImageFormat(Image *image, int newFormat);                                                     // Convert image data to desired format
+RLAPI void SetImageCompressionQuality(int quality);                                                      // Set quality for image conversion to DXT formats (CompressionQuality, default: COMPRESSION_NORMAL)
+RLAPI void SetImageFormatFast(bool enabled);                                                             // Enable ImageFormat() fast paths for common conversions (default: enabled, generic conversion otherwise)
 RLAPI void ImageToPOT(Image *image, Color fill);                                                         // Convert image to POT (power-of-two)
 RLAPI void ImageCrop(Image *image, Rectangle crop);                                                      // Crop an image to a defined rectangle
 RLAPI void ImageAlphaCrop(Image *image, float threshold);                                                // Crop image depending on alpha value
@@ -1171,6 +1216,8 @@ RLAPI void ImageResize(Image *image, int newWidth, int newHeight);
 RLAPI void ImageResizeNN(Image *image, int newWidth,int newHeight);                                      // Resize image (Nearest-Neighbor scaling algorithm)
 RLAPI void ImageResizeCanvas(Image *image, int newWidth, int newHeight, int offsetX, int offsetY, Color fill);  // Resize canvas and fill with color
 RLAPI void ImageMipmaps(Image *image);                                                                   // Generate all mipmap levels for a provided image
+RLAPI void SetImageProcessingThreads(int count);                                                         // Set threads count for ImageResize(), ImageMipmaps() and DXT compression (0 = all CPU cores, 1 = no threads)
+RLAPI int GetImageProcessingThreads(void);                                                               // Get threads count for ImageResize(), ImageMipmaps() and DXT compression
 RLAPI void ImageDither(Image *image, int rBpp, int gBpp, int bBpp, int aBpp);                            // Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
 RLAPI void ImageFlipVertical(Image *image);                                                              // Flip image vertically
 RLAPI void ImageFlipHorizontal(Image *image);                                                            // Flip image horizontally
@@ -1187,6 +1234,7 @@ RLAPI Color *LoadImagePalette(Image image, int maxPaletteSize, int *colorsCount)
 RLAPI void UnloadImageColors(Color *colors);                                                             // Unload color data loaded with LoadImageColors()
 RLAPI void UnloadImagePalette(Color *colors);                                                            // Unload colors palette loaded with LoadImagePalette()
 RLAPI Rectangle GetImageAlphaBorder(Image image, float threshold);                                       // Get image alpha border rectangle
+RLAPI float GetImagePSNR(Image image, Image reference);                                                  // Get image peak signal-to-noise ratio in dB, RGBA (compressed images decoded, INFINITY if equal)
 
 // Image drawing functions
 // NOTE: Image software-rendering functions (CPU)
@@ -1257,10 +1305,12 @@ RLAPI Font LoadFont(const char *fileName);
 RLAPI Font LoadFontEx(const char *fileName, int fontSize, int *fontChars, int charsCount);  // Load font from file with extended parameters
 RLAPI Font LoadFontFromImage(Image image, Color key, int firstChar);                        // Load font from Image (XNA style)
 RLAPI Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *fontChars, int charsCount); // Load font from memory buffer, fileType refers to extension: i.e. "ttf"
+RLAPI Font LoadFontDynamic(const char *fileName, int fontSize, int type);                   // Load font from TTF file, characters rasterized on first use into a growing atlas
 RLAPI CharInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *fontChars, int charsCount, int type);      // Load font data for further use
 RLAPI Image GenImageFontAtlas(const CharInfo *chars, Rectangle **recs, int charsCount, int fontSize, int padding, int packMethod);      // Generate image font atlas using chars info
 RLAPI void UnloadFontData(CharInfo *chars, int charsCount);                                 // Unload font chars info data (RAM)
 RLAPI void UnloadFont(Font font);                                                           // Unload Font from GPU memory (VRAM)
+RLAPI void UpdateFontGlyphIndex(Font *font);                                                // Update font characters lookup index (required if chars are set or modified manually)
 
 // Text drawing functions
 RLAPI void DrawFPS(int posX, int posY);                                                     // Shows current FPS
@@ -1270,6 +1320,9 @@ RLAPI void DrawTextRec(Font font, const char *text, Rectangle rec, float fontSiz
 RLAPI void DrawTextRecEx(Font font, const char *text, Rectangle rec, float fontSize, float spacing, bool wordWrap, Color tint,
                          int selectStart, int selectLength, Color selectTint, Color selectBackTint);    // Draw text using font inside rectangle limits with support for text selection
 RLAPI void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint);   // Draw one character (codepoint)
+RLAPI TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing);        // Load text layout (glyph quads computed once, font must outlive it)
+RLAPI void UnloadTextLayout(TextLayout layout);                                             // Unload text layout data (RAM)
+RLAPI void DrawTextLayout(TextLayout layout, Vector2 position, Color tint);                 // Draw text layout (single texture bind and batch submission)
 
 // Text misc. functions
 RLAPI int MeasureText(const char *text, int fontSize);                                      // Measure string width for default font
@@ -1450,9 +1503,16 @@ RLAPI void EndVrDrawing(void);                          // End VR simulator ster
 
 // Audio device management functions
 RLAPI void InitAudioDevice(void);                                     // Initialize audio device and context
+RLAPI void InitAudioDeviceNull(void);                                 // Initialize audio device and context on null backend (no sound output)
+RLAPI void InitAudioDeviceOffline(void);                              // Initialize audio device and context for offline rendering (mixed by RenderAudioFrames())
 RLAPI void CloseAudioDevice(void);                                    // Close the audio device and context
 RLAPI bool IsAudioDeviceReady(void);                                  // Check if audio device has been initialized successfully
 RLAPI void SetMasterVolume(float volume);                             // Set master volume (listener)
+RLAPI float GetAudioMixingLoad(void);                                 // Get mixer load since last call (mixing time / audio time, 1.0 is a full core)
+RLAPI void RenderAudioFrames(float *frames, int frameCount);          // Render audio offline: mix frames in device format (32bit float, stereo)
+RLAPI void MixAudioSamples(float *samplesOut, const float *samplesIn, unsigned int sampleCount, const float *gains, unsigned int channels); // Mix (accumulate) interleaved samples with a gain per channel (mixer kernel)
+RLAPI void ClampAudioSamples(float *samples, unsigned int sampleCount); // Clamp samples to output range [-1.0..1.0] (mixer kernel)
+RLAPI void SetAudioMixingSimd(bool enabled);                          // Enable SIMD mixing kernels (default: enabled, scalar code otherwise)
 
 // Wave/Sound loading/unloading functions
 RLAPI Wave LoadWave(const char *fileName);                            // Load wave data from file
@@ -1471,11 +1531,13 @@ RLAPI void StopSound(Sound sound);                                    // Stop pl
 RLAPI void PauseSound(Sound sound);                                   // Pause a sound
 RLAPI void ResumeSound(Sound sound);                                  // Resume a paused sound
 RLAPI void PlaySoundMulti(Sound sound);                               // Play a sound (using multichannel buffer pool)
+RLAPI void PlaySoundMultiEx(Sound sound, float volume, float pitch, int priority); // Play a sound (using multichannel buffer pool) with volume, pitch and priority (channel stealing)
 RLAPI void StopSoundMulti(void);                                      // Stop any sound playing (using multichannel buffer pool)
 RLAPI int GetSoundsPlaying(void);                                     // Get number of sounds playing in the multichannel
 RLAPI bool IsSoundPlaying(Sound sound);                               // Check if a sound is currently playing
 RLAPI void SetSoundVolume(Sound sound, float volume);                 // Set volume for a sound (1.0 is max level)
 RLAPI void SetSoundPitch(Sound sound, float pitch);                   // Set pitch for a sound (1.0 is base level)
+RLAPI void SetSoundPan(Sound sound, float pan);                       // Set pan for a sound (0.5 is center)
 RLAPI void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels);  // Convert wave data to desired format
 RLAPI Wave WaveCopy(Wave wave);                                       // Copy a wave to a new wave
 RLAPI void WaveCrop(Wave *wave, int initSample, int finalSample);     // Crop a wave to defined samples range
@@ -1487,12 +1549,14 @@ RLAPI Music LoadMusicStream(const char *fileName);                    // Load mu
 RLAPI void UnloadMusicStream(Music music);                            // Unload music stream
 RLAPI void PlayMusicStream(Music music);                              // Start music playing
 RLAPI void UpdateMusicStream(Music music);                            // Updates buffers for music streaming
+RLAPI bool StartMusicDecoder(Music music, float latency);             // Decode music ahead on a background thread (no UpdateMusicStream() required)
 RLAPI void StopMusicStream(Music music);                              // Stop music playing
 RLAPI void PauseMusicStream(Music music);                             // Pause music playing
 RLAPI void ResumeMusicStream(Music music);                            // Resume playing paused music
 RLAPI bool IsMusicPlaying(Music music);                               // Check if music is playing
 RLAPI void SetMusicVolume(Music music, float volume);                 // Set volume for music (1.0 is max level)
 RLAPI void SetMusicPitch(Music music, float pitch);                   // Set pitch for a music (1.0 is base level)
+RLAPI void SetMusicPan(Music music, float pan);                       // Set pan for a music (0.5 is center)
 RLAPI float GetMusicTimeLength(Music music);                          // Get music time length (in seconds)
 RLAPI float GetMusicTimePlayed(Music music);                          // Get current music time played (in seconds)
 
@@ -1508,6 +1572,7 @@ RLAPI bool IsAudioStreamPlaying(AudioStream stream);                  // Check i
 RLAPI void StopAudioStream(AudioStream stream);                       // Stop audio stream
 RLAPI void SetAudioStreamVolume(AudioStream stream, float volume);    // Set volume for audio stream (1.0 is max level)
 RLAPI void SetAudioStreamPitch(AudioStream stream, float pitch);      // Set pitch for audio stream (1.0 is base level)
+RLAPI void SetAudioStreamPan(AudioStream stream, float pan);          // Set pan for audio stream (0.5 is center)
 RLAPI void SetAudioStreamBufferSizeDefault(int size);                 // Default size for new audio streams
 
 #if defined(__cplusplus)
@@ -33,7 +33,7 @@
     #define _GLFW_WIN32
 #endif
 #if defined(__linux__)
-    #if !defined(_GLFW_WAYLAND)     // Required for Wayland windowing
+    #if !defined(_GLFW_WAYLAND) && !defined(_GLFW_OSMESA)   // Required for Wayland windowing and OSMesa headless
         #define _GLFW_X11
     #endif
 #endif
@@ -71,6 +71,12 @@
 #endif
 
 #if defined(__linux__)
+    #if defined(_GLFW_OSMESA)       // Headless: null window system, OpenGL context by OSMesa (software)
+        #include "external/glfw/src/null_init.c"
+        #include "external/glfw/src/null_monitor.c"
+        #include "external/glfw/src/null_window.c"
+        #include "external/glfw/src/null_joystick.c"
+    #endif
     #if defined(_GLFW_WAYLAND)
         #include "external/glfw/src/wl_init.c"
         #include "external/glfw/src/wl_monitor.c"
@@ -85,11 +91,13 @@
         #include "external/glfw/src/glx_context.c"
     #endif
 
-    #include "external/glfw/src/linux_joystick.c"
+    #if !defined(_GLFW_OSMESA)
+        #include "external/glfw/src/linux_joystick.c"
+        #include "external/glfw/src/xkb_unicode.c"
+        #include "external/glfw/src/egl_context.c"
+    #endif
     #include "external/glfw/src/posix_thread.c"
     #include "external/glfw/src/posix_time.c"
-    #include "external/glfw/src/xkb_unicode.c"
-    #include "external/glfw/src/egl_context.c"
     #include "external/glfw/src/osmesa_context.c"
 #endif
 
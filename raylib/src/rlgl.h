@@ -232,6 +232,28 @@ typedef enum {
     RL_ATTACHMENT_RENDERBUFFER = 200,
 } FramebufferTexType;
 
+// Render batch flush reasons (frame statistics)
+typedef enum {
+    RL_FLUSH_EXPLICIT = 0,          // rlglDraw() requested (mode changes, end of frame...)
+    RL_FLUSH_BUFFER_FULL,           // Vertex buffer or draw calls buffer full
+    RL_FLUSH_TEXTURE_CHANGE,        // Draw calls buffer full because of texture changes
+    RL_FLUSH_MATRIX_STACK,          // Vertex buffer full with matrices pushed (matrix stack unwound)
+    RL_FLUSH_STATE_CHANGE,          // Shader or blend mode change
+    RL_FLUSH_REASONS_COUNT
+} FlushReason;
+
+// Frame statistics, reset every frame
+typedef struct rlFrameStats {
+    int drawCalls;                  // Draw calls issued (batch and meshes)
+    int vertices;                   // Vertices submitted
+    int indices;                    // Indices submitted (quads and indexed meshes)
+    int bytesUploaded;              // Data bytes uploaded to GPU (batch vertices, meshes, buffers and textures)
+    int flushes;                    // Render batch flushes with vertex data
+    int flushReasons[RL_FLUSH_REASONS_COUNT];  // Render batch flushes by reason (FlushReason)
+    int textureSwitches;            // Batch texture changes
+    int shaderSwitches;             // Shader changes
+} rlFrameStats;
+
 #if defined(RLGL_STANDALONE)
     #ifndef __cplusplus
     // Boolean type
@@ -542,7 +564,10 @@ RLAPI void rlCheckErrors(void);                       // Check and log OpenGL er
 
 RLAPI int rlGetVersion(void);                         // Returns current OpenGL version
 RLAPI bool rlCheckBufferLimit(int vCount);            // Check internal buffer overflow for a given number of vertex
+RLAPI bool rlCheckRenderBatchLimit(int vCount);       // Check internal buffer overflow for a given number of vertex and force a draw call if required
 RLAPI void rlSetDebugMarker(const char *text);        // Set debug marker for analysis
+RLAPI rlFrameStats rlGetFrameStats(void);             // Get last frame statistics (draw calls, vertices, flushes...)
+RLAPI void rlResetFrameStats(void);                   // Close current frame statistics (called by EndDrawing())
 RLAPI void rlSetBlendMode(int glSrcFactor, int glDstFactor, int glEquation);    // // Set blending mode factor and equation (using OpenGL factors)
 RLAPI void rlLoadExtensions(void *loader);            // Load OpenGL extensions
 
@@ -557,6 +582,13 @@ RLAPI void rlUnloadTexture(unsigned int id);                              // Unl
 RLAPI void rlGenerateMipmaps(Texture2D *texture);                         // Generate mipmap data for selected texture
 RLAPI void *rlReadTexturePixels(Texture2D texture);                       // Read texture pixel data
 RLAPI unsigned char *rlReadScreenPixels(int width, int height);           // Read screen pixel data (color buffer)
+RLAPI void rlCopyScreenPixels(unsigned char *data, int width, int height); // Copy screen pixel data to provided buffer (RGBA, bottom-up rows, no flip)
+
+// Pixel buffers management (pbo, asynchronous readback)
+RLAPI unsigned int rlLoadPixelBuffer(int size);                           // Load pixel buffer for async readback (returns 0 if not supported)
+RLAPI void rlReadScreenPixelsAsync(unsigned int pboId, int width, int height);   // Queue screen pixels readback (RGBA) into pixel buffer, it does not stall
+RLAPI bool rlReadPixelBuffer(unsigned int pboId, void *data, int size);   // Copy pixel buffer data (RGBA, bottom-up rows) to CPU memory
+RLAPI void rlUnloadPixelBuffer(unsigned int pboId);                       // Unload pixel buffer
 
 // Framebuffer management (fbo)
 RLAPI unsigned int rlLoadFramebuffer(int width, int height);              // Load an empty framebuffer
@@ -884,6 +916,11 @@ typedef struct rlglData {
         int framebufferHeight;              // Default framebuffer height
 
     } State;
+    struct {
+        rlFrameStats current;               // Current frame statistics
+        rlFrameStats last;                  // Last frame statistics (returned by rlGetFrameStats())
+        int flushReason;                    // Reason of next render batch flush (FlushReason)
+    } Stats;
     struct {
         bool vao;                           // VAO support (OpenGL ES2 could not support VAO extension)
         bool texNPOT;                       // NPOT textures full support
@@ -1162,8 +1199,7 @@ void rlBegin(int mode)
 
             else RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment = 0;
 
-            if (rlCheckBufferLimit(RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment)) DrawRenderBatch(RLGL.currentBatch);
-            else
+            if (!rlCheckRenderBatchLimit(RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment))
             {
                 RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter += RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment;
                 RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].cCounter += RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment;
@@ -1173,7 +1209,11 @@ void rlBegin(int mode)
             }
         }
 
-        if (RLGL.currentBatch->drawsCounter >= DEFAULT_BATCH_DRAWCALLS) DrawRenderBatch(RLGL.currentBatch);
+        if (RLGL.currentBatch->drawsCounter >= DEFAULT_BATCH_DRAWCALLS)
+        {
+            RLGL.Stats.flushReason = RL_FLUSH_BUFFER_FULL;
+            DrawRenderBatch(RLGL.currentBatch);
+        }
 
         RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].mode = mode;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount = 0;
@@ -1229,6 +1269,7 @@ void rlEnd(void)
         // WARNING: If we are between rlPushMatrix() and rlPopMatrix() and we need to force a DrawRenderBatch(),
         // we need to call rlPopMatrix() before to recover *RLGL.State.currentMatrix (RLGL.State.modelview) for the next forced draw call!
         // If we have multiple matrix pushed, it will require "RLGL.State.stackCounter" pops before launching the draw
+        RLGL.Stats.flushReason = (RLGL.State.stackCounter > 0)? RL_FLUSH_MATRIX_STACK : RL_FLUSH_BUFFER_FULL;
         for (int i = RLGL.State.stackCounter; i >= 0; i--) rlPopMatrix();
         DrawRenderBatch(RLGL.currentBatch);
     }
@@ -1335,8 +1376,7 @@ void rlEnableTexture(unsigned int id)
 
             else RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment = 0;
 
-            if (rlCheckBufferLimit(RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment)) DrawRenderBatch(RLGL.currentBatch);
-            else
+            if (!rlCheckRenderBatchLimit(RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment))
             {
                 RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter += RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment;
                 RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].cCounter += RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexAlignment;
@@ -1346,9 +1386,14 @@ void rlEnableTexture(unsigned int id)
             }
         }
 
-        if (RLGL.currentBatch->drawsCounter >= DEFAULT_BATCH_DRAWCALLS) DrawRenderBatch(RLGL.currentBatch);
+        if (RLGL.currentBatch->drawsCounter >= DEFAULT_BATCH_DRAWCALLS)
+        {
+            RLGL.Stats.flushReason = RL_FLUSH_TEXTURE_CHANGE;
+            DrawRenderBatch(RLGL.currentBatch);
+        }
 
         RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].textureId = id;
+        RLGL.Stats.current.textureSwitches++;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawsCounter - 1].vertexCount = 0;
     }
 #endif
@@ -1363,7 +1408,11 @@ void rlDisableTexture(void)
 #else
     // NOTE: If quads batch limit is reached,
     // we force a draw call and next batch starts
-    if (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter >= (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementsCount*4)) DrawRenderBatch(RLGL.currentBatch);
+    if (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vCounter >= (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementsCount*4))
+    {
+        RLGL.Stats.flushReason = RL_FLUSH_BUFFER_FULL;
+        DrawRenderBatch(RLGL.currentBatch);
+    }
 #endif
 }
 
@@ -1564,6 +1613,7 @@ void rlUpdateBuffer(int bufferId, void *data, int dataSize)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glBindBuffer(GL_ARRAY_BUFFER, bufferId);
     glBufferSubData(GL_ARRAY_BUFFER, 0, dataSize, data);
+    RLGL.Stats.current.bytesUploaded += dataSize;
 #endif
 }
 
@@ -1914,6 +1964,40 @@ bool rlCheckBufferLimit(int vCount)
     return overflow;
 }
 
+// Check internal buffer overflow for a given number of vertex, render batch is drawn on overflow
+// NOTE: Flush is accounted as buffer full in frame statistics
+bool rlCheckRenderBatchLimit(int vCount)
+{
+    bool overflow = rlCheckBufferLimit(vCount);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (overflow)
+    {
+        RLGL.Stats.flushReason = RL_FLUSH_BUFFER_FULL;
+        DrawRenderBatch(RLGL.currentBatch);
+    }
+#endif
+    return overflow;
+}
+
+// Get last frame statistics
+rlFrameStats rlGetFrameStats(void)
+{
+    rlFrameStats stats = { 0 };
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    stats = RLGL.Stats.last;
+#endif
+    return stats;
+}
+
+// Close current frame statistics, they become last frame statistics
+void rlResetFrameStats(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.Stats.last = RLGL.Stats.current;
+    memset(&RLGL.Stats.current, 0, sizeof(rlFrameStats));
+#endif
+}
+
 // Set debug marker
 void rlSetDebugMarker(const char *text)
 {
@@ -2033,6 +2117,9 @@ unsigned int rlLoadTexture(void *data, int width, int height, int format, int mi
         #if !defined(GRAPHICS_API_OPENGL_11)
             else glCompressedTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, mipSize, (unsigned char *)data + mipOffset);
         #endif
+        #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+            if (data != NULL) RLGL.Stats.current.bytesUploaded += mipSize;
+        #endif
 
         #if defined(GRAPHICS_API_OPENGL_33)
             if (format == UNCOMPRESSED_GRAYSCALE)
@@ -2199,6 +2286,7 @@ unsigned int rlLoadTextureCubemap(void *data, int size, int format)
             {
                 if (format < COMPRESSED_DXT1_RGB) glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, glFormat, glType, (unsigned char *)data + i*dataSize);
                 else glCompressedTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, glInternalFormat, size, size, 0, dataSize, (unsigned char *)data + i*dataSize);
+                RLGL.Stats.current.bytesUploaded += dataSize;
             }
 
 #if defined(GRAPHICS_API_OPENGL_33)
@@ -2250,6 +2338,9 @@ void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int h
     if ((glInternalFormat != -1) && (format < COMPRESSED_DXT1_RGB))
     {
         glTexSubImage2D(GL_TEXTURE_2D, 0, offsetX, offsetY, width, height, glFormat, glType, (unsigned char *)data);
+    #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+        RLGL.Stats.current.bytesUploaded += GetPixelDataSize(width, height, format);
+    #endif
     }
     else TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Failed to update for current texture format (%i)", id, format);
 }
@@ -2587,6 +2678,14 @@ void rlLoadMesh(Mesh *mesh, bool dynamic)
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh->triangleCount*3*sizeof(unsigned short), mesh->indices, drawHint);
     }
 
+    // Update frame statistics: uploaded vertex attributes and indices
+    RLGL.Stats.current.bytesUploaded += mesh->vertexCount*(3*sizeof(float) + 2*sizeof(float));
+    if (mesh->normals != NULL) RLGL.Stats.current.bytesUploaded += mesh->vertexCount*3*sizeof(float);
+    if (mesh->colors != NULL) RLGL.Stats.current.bytesUploaded += mesh->vertexCount*4*sizeof(unsigned char);
+    if (mesh->tangents != NULL) RLGL.Stats.current.bytesUploaded += mesh->vertexCount*4*sizeof(float);
+    if (mesh->texcoords2 != NULL) RLGL.Stats.current.bytesUploaded += mesh->vertexCount*2*sizeof(float);
+    if (mesh->indices != NULL) RLGL.Stats.current.bytesUploaded += mesh->triangleCount*3*sizeof(unsigned short);
+
     if (RLGL.ExtSupported.vao)
     {
         if (mesh->vaoId > 0) TRACELOG(LOG_INFO, "VAO: [ID %i] Mesh uploaded successfully to VRAM (GPU)", mesh->vaoId);
@@ -2613,6 +2712,7 @@ unsigned int rlLoadAttribBuffer(unsigned int vaoId, int shaderLoc, void *buffer,
     glGenBuffers(1, &id);
     glBindBuffer(GL_ARRAY_BUFFER, id);
     glBufferData(GL_ARRAY_BUFFER, size, buffer, drawHint);
+    if (buffer != NULL) RLGL.Stats.current.bytesUploaded += size;
     glVertexAttribPointer(shaderLoc, 2, GL_FLOAT, 0, 0, 0);
     glEnableVertexAttribArray(shaderLoc);
 
@@ -2645,6 +2745,7 @@ void rlUpdateMeshAt(Mesh mesh, int buffer, int count, int index)
             if (index == 0 && count >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, count*3*sizeof(float), mesh.vertices, GL_DYNAMIC_DRAW);
             else if (index + count >= mesh.vertexCount) break;
             else glBufferSubData(GL_ARRAY_BUFFER, index*3*sizeof(float), count*3*sizeof(float), mesh.vertices);
+            RLGL.Stats.current.bytesUploaded += count*3*sizeof(float);
 
         } break;
         case 1:     // Update texcoords (vertex texture coordinates)
@@ -2653,6 +2754,7 @@ void rlUpdateMeshAt(Mesh mesh, int buffer, int count, int index)
             if (index == 0 && count >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, count*2*sizeof(float), mesh.texcoords, GL_DYNAMIC_DRAW);
             else if (index + count >= mesh.vertexCount) break;
             else glBufferSubData(GL_ARRAY_BUFFER, index*2*sizeof(float), count*2*sizeof(float), mesh.texcoords);
+            RLGL.Stats.current.bytesUploaded += count*2*sizeof(float);
 
         } break;
         case 2:     // Update normals (vertex normals)
@@ -2661,6 +2763,7 @@ void rlUpdateMeshAt(Mesh mesh, int buffer, int count, int index)
             if (index == 0 && count >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, count*3*sizeof(float), mesh.normals, GL_DYNAMIC_DRAW);
             else if (index + count >= mesh.vertexCount) break;
             else glBufferSubData(GL_ARRAY_BUFFER, index*3*sizeof(float), count*3*sizeof(float), mesh.normals);
+            RLGL.Stats.current.bytesUploaded += count*3*sizeof(float);
 
         } break;
         case 3:     // Update colors (vertex colors)
@@ -2669,6 +2772,7 @@ void rlUpdateMeshAt(Mesh mesh, int buffer, int count, int index)
             if (index == 0 && count >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, count*4*sizeof(unsigned char), mesh.colors, GL_DYNAMIC_DRAW);
             else if (index + count >= mesh.vertexCount) break;
             else glBufferSubData(GL_ARRAY_BUFFER, index*4*sizeof(unsigned char), count*4*sizeof(unsigned char), mesh.colors);
+            RLGL.Stats.current.bytesUploaded += count*4*sizeof(unsigned char);
 
         } break;
         case 4:     // Update tangents (vertex tangents)
@@ -2677,6 +2781,7 @@ void rlUpdateMeshAt(Mesh mesh, int buffer, int count, int index)
             if (index == 0 && count >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, count*4*sizeof(float), mesh.tangents, GL_DYNAMIC_DRAW);
             else if (index + count >= mesh.vertexCount) break;
             else glBufferSubData(GL_ARRAY_BUFFER, index*4*sizeof(float), count*4*sizeof(float), mesh.tangents);
+            RLGL.Stats.current.bytesUploaded += count*4*sizeof(float);
 
         } break;
         case 5:     // Update texcoords2 (vertex second texture coordinates)
@@ -2685,6 +2790,7 @@ void rlUpdateMeshAt(Mesh mesh, int buffer, int count, int index)
             if (index == 0 && count >= mesh.vertexCount) glBufferData(GL_ARRAY_BUFFER, count*2*sizeof(float), mesh.texcoords2, GL_DYNAMIC_DRAW);
             else if (index + count >= mesh.vertexCount) break;
             else glBufferSubData(GL_ARRAY_BUFFER, index*2*sizeof(float), count*2*sizeof(float), mesh.texcoords2);
+            RLGL.Stats.current.bytesUploaded += count*2*sizeof(float);
 
         } break;
         case 6:     // Update indices (triangle index buffer)
@@ -2696,6 +2802,7 @@ void rlUpdateMeshAt(Mesh mesh, int buffer, int count, int index)
             if (index == 0 && count >= mesh.triangleCount) glBufferData(GL_ELEMENT_ARRAY_BUFFER, count*3*sizeof(*indices), indices, GL_DYNAMIC_DRAW);
             else if (index + count >= mesh.triangleCount) break;
             else glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, index*3*sizeof(*indices), count*3*sizeof(*indices), indices);
+            RLGL.Stats.current.bytesUploaded += count*3*sizeof(*indices);
 
         } break;
         default: break;
@@ -2879,6 +2986,10 @@ void rlDrawMesh(Mesh mesh, Material material, Matrix transform)
         // Draw call!
         if (mesh.indices != NULL) glDrawElements(GL_TRIANGLES, mesh.triangleCount*3, GL_UNSIGNED_SHORT, 0); // Indexed vertices draw
         else glDrawArrays(GL_TRIANGLES, 0, mesh.vertexCount);
+
+        RLGL.Stats.current.drawCalls++;
+        RLGL.Stats.current.vertices += mesh.vertexCount;
+        if (mesh.indices != NULL) RLGL.Stats.current.indices += mesh.triangleCount*3;
     }
 
     // Unbind all binded texture maps
@@ -2980,6 +3091,11 @@ void rlDrawMeshInstanced(Mesh mesh, Material material, Matrix *transforms, int c
     if (mesh.indices != NULL) glDrawElementsInstanced(GL_TRIANGLES, mesh.triangleCount*3, GL_UNSIGNED_SHORT, 0, count);
     else glDrawArraysInstanced(GL_TRIANGLES, 0, mesh.vertexCount, count);
 
+    RLGL.Stats.current.drawCalls++;
+    RLGL.Stats.current.vertices += mesh.vertexCount*count;
+    if (mesh.indices != NULL) RLGL.Stats.current.indices += mesh.triangleCount*3*count;
+    RLGL.Stats.current.bytesUploaded += count*sizeof(float16);
+
     glDeleteBuffers(1, &instancesB);
     RL_FREE(instances);
 
@@ -3059,6 +3175,84 @@ unsigned char *rlReadScreenPixels(int width, int height)
     return imgData;     // NOTE: image data should be freed
 }
 
+// Copy screen pixel data (color buffer) to provided buffer
+// NOTE: Data is not flipped vertically and alpha is not modified, buffer must hold width*height*4 bytes
+void rlCopyScreenPixels(unsigned char *data, int width, int height)
+{
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, data);
+}
+
+// Load pixel buffer for async readback
+// NOTE: Only supported on OpenGL 3.3, returns 0 otherwise (use rlReadScreenPixels())
+unsigned int rlLoadPixelBuffer(int size)
+{
+    unsigned int pboId = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    glGenBuffers(1, &pboId);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, pboId);
+    glBufferData(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    if (pboId > 0) TRACELOG(LOG_DEBUG, "PBO: [ID %i] Pixel buffer loaded successfully (%i bytes)", pboId, size);
+#else
+    (void)size;
+#endif
+
+    return pboId;
+}
+
+// Queue screen pixels readback into pixel buffer
+// NOTE: glReadPixels() returns immediately when a pack buffer is bound, transfer is done by the driver
+void rlReadScreenPixelsAsync(unsigned int pboId, int width, int height)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, pboId);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#else
+    (void)pboId; (void)width; (void)height;
+#endif
+}
+
+// Copy pixel buffer data to CPU memory
+// NOTE 1: Data is not flipped vertically -> (0,0) is the bottom left corner of the framebuffer
+// NOTE 2: It waits for the transfer to finish, read buffers a few frames after queueing them to avoid stalls
+bool rlReadPixelBuffer(unsigned int pboId, void *data, int size)
+{
+    bool result = false;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, pboId);
+
+    void *mapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT);
+
+    if (mapped != NULL)
+    {
+        memcpy(data, mapped, size);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        result = true;
+    }
+    else TRACELOG(LOG_WARNING, "PBO: [ID %i] Failed to map pixel buffer", pboId);
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#else
+    (void)pboId; (void)data; (void)size;
+#endif
+
+    return result;
+}
+
+// Unload pixel buffer
+void rlUnloadPixelBuffer(unsigned int pboId)
+{
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (pboId > 0) glDeleteBuffers(1, &pboId);
+#else
+    (void)pboId;
+#endif
+}
+
 // Read texture pixel data
 void *rlReadTexturePixels(Texture2D texture)
 {
@@ -3298,8 +3492,10 @@ void BeginShaderMode(Shader shader)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (RLGL.State.currentShader.id != shader.id)
     {
+        RLGL.Stats.flushReason = RL_FLUSH_STATE_CHANGE;
         DrawRenderBatch(RLGL.currentBatch);
         RLGL.State.currentShader = shader;
+        RLGL.Stats.current.shaderSwitches++;
     }
 #endif
 }
@@ -3770,6 +3966,7 @@ void BeginBlendMode(int mode)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (RLGL.State.currentBlendMode != mode)
     {
+        RLGL.Stats.flushReason = RL_FLUSH_STATE_CHANGE;
         DrawRenderBatch(RLGL.currentBatch);
 
         switch (mode)
@@ -4408,6 +4605,16 @@ static RenderBatch LoadRenderBatch(int numBuffers, int bufferElements)
 // NOTE: We require a pointer to reset batch and increase current buffer (multi-buffer)
 static void DrawRenderBatch(RenderBatch *batch)
 {
+    // Update frame statistics
+    if (batch->vertexBuffer[batch->currentBuffer].vCounter > 0)
+    {
+        RLGL.Stats.current.flushes++;
+        RLGL.Stats.current.flushReasons[RLGL.Stats.flushReason]++;
+        RLGL.Stats.current.vertices += batch->vertexBuffer[batch->currentBuffer].vCounter;
+        RLGL.Stats.current.bytesUploaded += batch->vertexBuffer[batch->currentBuffer].vCounter*(3*sizeof(float) + 2*sizeof(float) + 4*sizeof(unsigned char));
+    }
+    RLGL.Stats.flushReason = RL_FLUSH_EXPLICIT;
+
     // Update batch vertex buffers
     //------------------------------------------------------------------------------------------------------------
     // NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0)
@@ -4522,9 +4729,13 @@ static void DrawRenderBatch(RenderBatch *batch)
                 // Bind current draw call texture, activated as GL_TEXTURE0 and binded to sampler2D texture0 by default
                 glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
 
+                RLGL.Stats.current.drawCalls++;
+
                 if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
                 else
                 {
+                    RLGL.Stats.current.indices += batch->draws[i].vertexCount/4*6;
+
 #if defined(GRAPHICS_API_OPENGL_33)
                     // We need to define the number of indices to be processed: quadsCount*6
                     // NOTE: The final parameter tells the GPU the offset in bytes from the
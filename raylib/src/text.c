@@ -59,7 +59,8 @@
 #include <stdarg.h>         // Required for: va_list, va_start(), vsprintf(), va_end() [Used in TextFormat()]
 #include <ctype.h>          // Requried for: toupper(), tolower() [Used in TextToUpper(), TextToLower()]
 
-#include "utils.h"          // Required for: LoadFileText()
+#include "utils.h"          // Required for: LoadFileText(), RunJobsParallel() [Used in LoadFontData()]
+#include "rlgl.h"           // Required for: rlEnableTexture(), rlBegin(), rlCheckRenderBatchLimit() [Used in DrawTextLayout()], rlUpdateTexture()
 
 #if defined(SUPPORT_FILEFORMAT_TTF)
     #define STB_RECT_PACK_IMPLEMENTATION
@@ -83,11 +84,76 @@
 #ifndef MAX_TEXTSPLIT_COUNT
     #define MAX_TEXTSPLIT_COUNT                  128        // Maximum number of substrings to split: TextSplit()
 #endif
+#ifndef MAX_TEXT_LAYOUT_BATCH_QUADS
+    #define MAX_TEXT_LAYOUT_BATCH_QUADS         1024        // Maximum number of glyph quads sent at once: DrawTextLayout()
+#endif
+
+#ifndef MAX_FONT_PARALLEL_MIN_GLYPHS
+    #define MAX_FONT_PARALLEL_MIN_GLYPHS          32        // Minimum glyphs count to rasterize on multiple threads: LoadFontData()
+#endif
+#ifndef MAX_FONT_DYNAMIC_GLYPHS
+    #define MAX_FONT_DYNAMIC_GLYPHS             4096        // Maximum number of glyphs loaded by a dynamic font: LoadFontDynamic()
+#endif
+#ifndef MAX_FONT_DYNAMIC_ATLAS_SIZE
+    #define MAX_FONT_DYNAMIC_ATLAS_SIZE         4096        // Maximum dynamic font atlas texture height: LoadFontDynamic()
+#endif
+
+// NOTE: Using some SDF generation default values,
+// trades off precision with ability to handle *smaller* sizes
+#ifndef FONT_SDF_CHAR_PADDING
+    #define FONT_SDF_CHAR_PADDING            4      // SDF font generation char padding
+#endif
+#ifndef FONT_SDF_ON_EDGE_VALUE
+    #define FONT_SDF_ON_EDGE_VALUE         128      // SDF font generation on edge value
+#endif
+#ifndef FONT_SDF_PIXEL_DIST_SCALE
+    #define FONT_SDF_PIXEL_DIST_SCALE     64.0f     // SDF font generation pixel distance scale
+#endif
+#ifndef FONT_BITMAP_ALPHA_THRESHOLD
+    #define FONT_BITMAP_ALPHA_THRESHOLD     80      // Bitmap (B&W) font generation alpha threshold
+#endif
+
+#define GLYPH_INDEX_DIRECT_CODEPOINTS            256        // Codepoints found by direct table lookup (ASCII, Latin-1), others by binary search
+#define FONT_PARALLEL_JOBS_PER_THREAD              4        // Glyphs ranges per thread, balances glyphs of different complexity
+#define FONT_DYNAMIC_LOOKUP_SLOTS    (2*MAX_FONT_DYNAMIC_GLYPHS)    // Dynamic font codepoints lookup table size (power of two)
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Glyphs rasterization job, range of font chars
+typedef struct FontGlyphsJob {
+    const stbtt_fontinfo *fontInfo; // Font info (only read, shared by jobs)
+    float scaleFactor;              // Font scale factor for required size
+    int ascent;                     // Font ascent (unscaled)
+    int fontSize;                   // Font size (char-height)
+    int type;                       // Font type: FONT_DEFAULT, FONT_BITMAP, FONT_SDF
+    const int *fontChars;           // Chars codepoints
+    CharInfo *chars;                // Chars info to fill
+    int firstChar;                  // First char of the range
+    int charsCount;                 // Chars in the range
+} FontGlyphsJob;
+
+// Dynamic font glyphs atlas (LoadFontDynamic())
+// NOTE: Font chars and recs arrays are allocated for MAX_FONT_DYNAMIC_GLYPHS and never moved,
+// glyphs loaded later are available to all copies of the font
+struct rFontAtlas {
+    unsigned char *fileData;        // TTF file data, required by fontInfo
+    stbtt_fontinfo fontInfo;        // Font info for glyphs rasterization
+    float scaleFactor;              // Font scale factor for base size
+    int ascent;                     // Font ascent (unscaled)
+    int type;                       // Font type: FONT_DEFAULT, FONT_BITMAP, FONT_SDF
+    int glyphsCount;                // Glyphs loaded in font chars and recs (first one is fallback '?')
+    int *lookup;                    // Codepoints lookup: (codepoint, glyph index) pairs, open addressing (-1: empty slot)
+    int lookupCount;                // Codepoints in lookup (not found codepoints point to fallback glyph)
+    Image image;                    // Atlas image (GRAY_ALPHA), texture data copy
+    Texture2D texture;              // Atlas texture, reloaded when atlas grows
+    stbrp_context packer;           // Atlas rectangles packer (skyline), its height follows atlas height
+    stbrp_node *nodes;              // Packer nodes, one per atlas column
+    int dirtyTop;                   // First atlas row not updated in texture
+    int dirtyBottom;                // Last atlas row not updated in texture + 1 (0: texture up to date)
+};
+#endif
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -109,6 +175,13 @@ static Font defaultFont = { 0 };
 #if defined(SUPPORT_FILEFORMAT_FNT)
 static Font LoadBMFont(const char *fileName);     // Load a BMFont file (AngelCode font file)
 #endif
+static int CompareGlyphCodepoints(const void *a, const void *b);   // Compare glyph index entries (codepoint, index) for qsort()
+static Texture2D GetFontTexture(Font font);     // Get font texture, dynamic font atlas updated
+#if defined(SUPPORT_FILEFORMAT_TTF)
+static void LoadGlyph(const stbtt_fontinfo *fontInfo, float scaleFactor, int ascent, int fontSize, int type, int codepoint, CharInfo *glyph);    // Rasterize one glyph
+static void LoadGlyphsRange(void *data);        // Rasterization job: glyphs range
+static int LoadFontAtlasGlyph(Font font, int codepoint);    // Get glyph index on dynamic font, glyph rasterized and packed on first use
+#endif
 
 #if defined(SUPPORT_DEFAULT_FONT)
 extern void LoadFontDefault(void);
@@ -265,6 +338,7 @@ extern void LoadFontDefault(void)
     UnloadImage(imFont);
 
     defaultFont.baseSize = (int)defaultFont.recs[0].height;
+    UpdateFontGlyphIndex(&defaultFont);
 
     TRACELOG(LOG_INFO, "FONT: Default font loaded successfully");
 }
@@ -276,6 +350,7 @@ extern void UnloadFontDefault(void)
     UnloadTexture(defaultFont.texture);
     RL_FREE(defaultFont.chars);
     RL_FREE(defaultFont.recs);
+    RL_FREE(defaultFont.glyphIndex);
 }
 #endif      // SUPPORT_DEFAULT_FONT
 
@@ -476,6 +551,8 @@ Font LoadFontFromImage(Image image, Color key, int firstChar)
 
     font.baseSize = (int)font.recs[0].height;
 
+    UpdateFontGlyphIndex(&font);
+
     return font;
 }
 
@@ -485,7 +562,8 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
     Font font = { 0 };
 
     char fileExtLower[16] = { 0 };
-    strcpy(fileExtLower, TextToLower(fileType));
+    // NOTE: Lowered locally, TextToLower() static buffer is not safe for loading from multiple threads
+    for (int i = 0; (i < 15) && (fileType[i] != '\0'); i++) fileExtLower[i] = ((fileType[i] >= 'A') && (fileType[i] <= 'Z'))? fileType[i] + 32 : fileType[i];
 
 #if defined(SUPPORT_FILEFORMAT_TTF)
     if (TextIsEqual(fileExtLower, "ttf") ||
@@ -511,6 +589,7 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
             }
 
             UnloadImage(atlas);
+            UpdateFontGlyphIndex(&font);
         }
         else font = GetFontDefault();
     }
@@ -521,25 +600,88 @@ Font LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int
     return font;
 }
 
+// Load font from TTF file for dynamic glyphs loading: chars are rasterized on first use (drawing or measuring text)
+// and packed into an atlas growing with loaded glyphs, only modified atlas rows are updated in texture
+// NOTE: Atlas texture is reloaded when atlas grows (texture filter set again: point, bilinear for SDF), font.texture
+// is atlas texture on loading: text drawing functions use current one, text layouts must be loaded again
+Font LoadFontDynamic(const char *fileName, int fontSize, int type)
+{
+    Font font = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    rFontAtlas *atlas = (rFontAtlas *)RL_CALLOC(1, sizeof(rFontAtlas));
+
+    unsigned int fileSize = 0;
+    atlas->fileData = LoadFileData(fileName, &fileSize);
+
+    if ((atlas->fileData != NULL) && stbtt_InitFont(&atlas->fontInfo, atlas->fileData, 0))
+    {
+        int descent, lineGap;
+        stbtt_GetFontVMetrics(&atlas->fontInfo, &atlas->ascent, &descent, &lineGap);
+        atlas->scaleFactor = stbtt_ScaleForPixelHeight(&atlas->fontInfo, (float)fontSize);
+        atlas->type = type;
+
+        atlas->lookup = (int *)RL_MALLOC(FONT_DYNAMIC_LOOKUP_SLOTS*2*sizeof(int));
+        for (int i = 0; i < FONT_DYNAMIC_LOOKUP_SLOTS; i++) atlas->lookup[i*2 + 1] = -1;
+
+        // Atlas initial size: about 16 glyphs per row and 2 rows, height doubled when required
+        int glyphSize = fontSize + 2*FONT_TTF_DEFAULT_CHARS_PADDING + ((type == FONT_SDF)? 2*FONT_SDF_CHAR_PADDING : 0);
+        int width = 64;
+        int height = 64;
+        while ((width < 16*glyphSize) && (width < MAX_FONT_DYNAMIC_ATLAS_SIZE)) width *= 2;
+        while ((height < 2*glyphSize) && (height < MAX_FONT_DYNAMIC_ATLAS_SIZE)) height *= 2;
+
+        atlas->image.data = RL_MALLOC(width*height*2);
+        atlas->image.width = width;
+        atlas->image.height = height;
+        atlas->image.mipmaps = 1;
+        atlas->image.format = UNCOMPRESSED_GRAY_ALPHA;
+
+        for (int i = 0; i < width*height; i++)
+        {
+            ((unsigned char *)atlas->image.data)[i*2] = 255;
+            ((unsigned char *)atlas->image.data)[i*2 + 1] = 0;
+        }
+
+        atlas->nodes = (stbrp_node *)RL_MALLOC(width*sizeof(stbrp_node));
+        stbrp_init_target(&atlas->packer, width, height, atlas->nodes, width);
+
+        atlas->texture = LoadTextureFromImage(atlas->image);
+        SetTextureFilter(atlas->texture, (type == FONT_SDF)? FILTER_BILINEAR : FILTER_POINT);
+
+        font.baseSize = fontSize;
+        font.charsPadding = FONT_TTF_DEFAULT_CHARS_PADDING;
+        font.chars = (CharInfo *)RL_CALLOC(MAX_FONT_DYNAMIC_GLYPHS, sizeof(CharInfo));
+        font.recs = (Rectangle *)RL_CALLOC(MAX_FONT_DYNAMIC_GLYPHS, sizeof(Rectangle));
+        font.atlas = atlas;
+
+        // NOTE: Fallback glyph '?' is loaded first (index 0)
+        LoadFontAtlasGlyph(font, '?');
+
+        font.charsCount = atlas->glyphsCount;
+        font.texture = atlas->texture;
+
+        TRACELOG(LOG_INFO, "FONT: [%s] Dynamic font loaded successfully (atlas %ix%i)", fileName, atlas->image.width, atlas->image.height);
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "FONT: [%s] Failed to load dynamic font -> Using default font", fileName);
+
+        RL_FREE(atlas->fileData);
+        RL_FREE(atlas);
+        font = GetFontDefault();
+    }
+#else
+    font = GetFontDefault();
+#endif
+
+    return font;
+}
+
 // Load font data for further use
 // NOTE: Requires TTF font memory data and can generate SDF data
 CharInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *fontChars, int charsCount, int type)
 {
-    // NOTE: Using some SDF generation default values,
-    // trades off precision with ability to handle *smaller* sizes
-#ifndef FONT_SDF_CHAR_PADDING
-    #define FONT_SDF_CHAR_PADDING            4      // SDF font generation char padding
-#endif
-#ifndef FONT_SDF_ON_EDGE_VALUE
-    #define FONT_SDF_ON_EDGE_VALUE         128      // SDF font generation on edge value
-#endif
-#ifndef FONT_SDF_PIXEL_DIST_SCALE
-    #define FONT_SDF_PIXEL_DIST_SCALE     64.0f     // SDF font generation pixel distance scale
-#endif
-#ifndef FONT_BITMAP_ALPHA_THRESHOLD
-    #define FONT_BITMAP_ALPHA_THRESHOLD     80      // Bitmap (B&W) font generation alpha threshold
-#endif
-
     CharInfo *chars = NULL;
 
 #if defined(SUPPORT_FILEFORMAT_TTF)
@@ -575,67 +717,34 @@ CharInfo *LoadFontData(const unsigned char *fileData, int dataSize, int fontSize
 
             chars = (CharInfo *)RL_MALLOC(charsCount*sizeof(CharInfo));
 
-            // NOTE: Using simple packaging, one char after another
-            for (int i = 0; i < charsCount; i++)
-            {
-                int chw = 0, chh = 0;   // Character width and height (on generation)
-                int ch = fontChars[i];  // Character value to get info for
-                chars[i].value = ch;
-
-                //  Render a unicode codepoint to a bitmap
-                //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
-                //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
-                //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
-
-                if (type != FONT_SDF) chars[i].image.data = stbtt_GetCodepointBitmap(&fontInfo, scaleFactor, scaleFactor, ch, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
-                else if (ch != 32) chars[i].image.data = stbtt_GetCodepointSDF(&fontInfo, scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY);
-                else chars[i].image.data = NULL;
-
-                stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
-                chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
-
-                // Load characters images
-                chars[i].image.width = chw;
-                chars[i].image.height = chh;
-                chars[i].image.mipmaps = 1;
-                chars[i].image.format = UNCOMPRESSED_GRAYSCALE;
+            // NOTE: Glyphs are rasterized independently (font info is only read),
+            // chars are split in ranges rasterized in parallel
+            FontGlyphsJob job = { &fontInfo, scaleFactor, ascent, fontSize, type, fontChars, chars, 0, charsCount };
+            int jobsCount = 1;
+            int threadCount = 1;
 
-                chars[i].offsetY += (int)((float)ascent*scaleFactor);
+#if defined(SUPPORT_FONT_PARALLEL)
+            threadCount = GetCPUCount();
 
-                // NOTE: We create an empty image for space character, it could be further required for atlas packing
-                if (ch == 32)
-                {
-                    Image imSpace = {
-                        .data = calloc(chars[i].advanceX*fontSize, 2),
-                        .width = chars[i].advanceX,
-                        .height = fontSize,
-                        .format = UNCOMPRESSED_GRAYSCALE,
-                        .mipmaps = 1
-                    };
-
-                    chars[i].image = imSpace;
-                }
+            if ((threadCount > 1) && (charsCount >= MAX_FONT_PARALLEL_MIN_GLYPHS))
+            {
+                jobsCount = threadCount*FONT_PARALLEL_JOBS_PER_THREAD;
+                if (jobsCount > charsCount) jobsCount = charsCount;
+            }
+#endif
+            FontGlyphsJob *jobs = (FontGlyphsJob *)RL_MALLOC(jobsCount*sizeof(FontGlyphsJob));
 
-                if (type == FONT_BITMAP)
-                {
-                    // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
-                    // NOTE: For optimum results, bitmap font should be generated at base pixel size
-                    for (int p = 0; p < chw*chh; p++)
-                    {
-                        if (((unsigned char *)chars[i].image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)chars[i].image.data)[p] = 0;
-                        else ((unsigned char *)chars[i].image.data)[p] = 255;
-                    }
-                }
+            for (int i = 0, firstChar = 0; i < jobsCount; i++)
+            {
+                jobs[i] = job;
+                jobs[i].firstChar = firstChar;
+                jobs[i].charsCount = charsCount/jobsCount + ((i < (charsCount%jobsCount))? 1 : 0);
+                firstChar += jobs[i].charsCount;
+            }
 
-                // Get bounding box for character (may be offset to account for chars that dip above or below the line)
-                /*
-                int chX1, chY1, chX2, chY2;
-                stbtt_GetCodepointBitmapBox(&fontInfo, ch, scaleFactor, scaleFactor, &chX1, &chY1, &chX2, &chY2);
+            RunJobsParallel(LoadGlyphsRange, jobs, sizeof(FontGlyphsJob), jobsCount, threadCount);
 
-                TRACELOGD("FONT: Character box measures: %i, %i, %i, %i", chX1, chY1, chX2 - chX1, chY2 - chY1);
-                TRACELOGD("FONT: Character offsetY: %i", (int)((float)ascent*scaleFactor) + chY1);
-                */
-            }
+            RL_FREE(jobs);
         }
         else TRACELOG(LOG_WARNING, "FONT: Failed to process TTF font data");
 
@@ -805,14 +914,67 @@ void UnloadFont(Font font)
     // NOTE: Make sure font is not default font (fallback)
     if (font.texture.id != GetFontDefault().texture.id)
     {
+#if defined(SUPPORT_FILEFORMAT_TTF)
+        if (font.atlas != NULL)
+        {
+            // NOTE: Dynamic font glyphs and texture are the ones of atlas
+            font.charsCount = font.atlas->glyphsCount;
+            font.texture = font.atlas->texture;
+
+            RL_FREE(font.atlas->fileData);
+            RL_FREE(font.atlas->lookup);
+            RL_FREE(font.atlas->nodes);
+            UnloadImage(font.atlas->image);
+            RL_FREE(font.atlas);
+        }
+#endif
         UnloadFontData(font.chars, font.charsCount);
         UnloadTexture(font.texture);
         RL_FREE(font.recs);
+        RL_FREE(font.glyphIndex);
 
         TRACELOGD("FONT: Unloaded font data from RAM and VRAM");
     }
 }
 
+// Update font characters lookup index, built from chars codepoints
+// NOTE: Index data: direct table for first codepoints (glyph index or -1),
+// then other codepoints count and (codepoint, glyph index) pairs sorted by codepoint
+void UpdateFontGlyphIndex(Font *font)
+{
+    RL_FREE(font->glyphIndex);
+    font->glyphIndex = NULL;
+
+    if ((font->chars == NULL) || (font->charsCount <= 0)) return;
+
+    int othersCount = 0;
+    for (int i = 0; i < font->charsCount; i++) if ((font->chars[i].value < 0) || (font->chars[i].value >= GLYPH_INDEX_DIRECT_CODEPOINTS)) othersCount++;
+
+    int *glyphIndex = (int *)RL_MALLOC((GLYPH_INDEX_DIRECT_CODEPOINTS + 1 + othersCount*2)*sizeof(int));
+    int *others = glyphIndex + GLYPH_INDEX_DIRECT_CODEPOINTS + 1;
+
+    for (int i = 0; i < GLYPH_INDEX_DIRECT_CODEPOINTS; i++) glyphIndex[i] = -1;
+    glyphIndex[GLYPH_INDEX_DIRECT_CODEPOINTS] = othersCount;
+
+    // NOTE: In case of duplicated codepoints, first glyph is kept (as linear search)
+    for (int i = font->charsCount - 1, k = othersCount; i >= 0; i--)
+    {
+        int codepoint = font->chars[i].value;
+
+        if ((codepoint >= 0) && (codepoint < GLYPH_INDEX_DIRECT_CODEPOINTS)) glyphIndex[codepoint] = i;
+        else
+        {
+            k--;
+            others[k*2] = codepoint;
+            others[k*2 + 1] = i;
+        }
+    }
+
+    qsort(others, othersCount, 2*sizeof(int), CompareGlyphCodepoints);
+
+    font->glyphIndex = glyphIndex;
+}
+
 // Shows current FPS on top-left corner
 // NOTE: Uses default font
 void DrawFPS(int posX, int posY)
@@ -859,7 +1021,7 @@ void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSiz
                          font.recs[index].width + 2.0f*font.charsPadding, font.recs[index].height + 2.0f*font.charsPadding };
 
     // Draw the character texture on the screen
-    DrawTexturePro(font.texture, srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
+    DrawTexturePro(GetFontTexture(font), srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
 }
 
 // Draw text using Font
@@ -906,6 +1068,110 @@ void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, f
     }
 }
 
+// Load text layout: glyph quads computed once, for text drawn many times without changes
+// NOTE: Layout keeps font texture id, font must not be unloaded before layout
+TextLayout LoadTextLayout(Font font, const char *text, float fontSize, float spacing)
+{
+    TextLayout layout = { 0 };
+    layout.size = MeasureTextEx(font, text, fontSize, spacing);
+    layout.texture = GetFontTexture(font);      // NOTE: Dynamic font glyphs loaded on measuring
+
+    int length = TextLength(text);
+    layout.sources = (Rectangle *)RL_MALLOC(length*sizeof(Rectangle));     // One quad per byte at most
+    layout.dests = (Rectangle *)RL_MALLOC(length*sizeof(Rectangle));
+
+    int textOffsetY = 0;            // Offset between lines (on line break '\n')
+    float textOffsetX = 0.0f;       // Offset X to next character to draw
+
+    float scaleFactor = fontSize/font.baseSize;     // Character quad scaling factor
+
+    // NOTE: Same layout as DrawTextEx() and same quads as DrawTextCodepoint()
+    for (int i = 0; i < length;)
+    {
+        int codepointByteCount = 0;
+        int codepoint = GetNextCodepoint(&text[i], &codepointByteCount);
+        int index = GetGlyphIndex(font, codepoint);
+
+        if (codepoint == 0x3f) codepointByteCount = 1;
+
+        if (codepoint == '\n')
+        {
+            textOffsetY += (int)((font.baseSize + font.baseSize/2)*scaleFactor);
+            textOffsetX = 0.0f;
+        }
+        else
+        {
+            if ((codepoint != ' ') && (codepoint != '\t'))
+            {
+                Rectangle srcRec = { font.recs[index].x - (float)font.charsPadding, font.recs[index].y - (float)font.charsPadding,
+                                     font.recs[index].width + 2.0f*font.charsPadding, font.recs[index].height + 2.0f*font.charsPadding };
+
+                // Texture coordinates are stored normalized
+                layout.sources[layout.quadsCount] = (Rectangle){ srcRec.x/layout.texture.width, srcRec.y/layout.texture.height,
+                                                                 srcRec.width/layout.texture.width, srcRec.height/layout.texture.height };
+                layout.dests[layout.quadsCount] = (Rectangle){ textOffsetX + font.chars[index].offsetX*scaleFactor - (float)font.charsPadding*scaleFactor,
+                                                               textOffsetY + font.chars[index].offsetY*scaleFactor - (float)font.charsPadding*scaleFactor,
+                                                               (font.recs[index].width + 2.0f*font.charsPadding)*scaleFactor,
+                                                               (font.recs[index].height + 2.0f*font.charsPadding)*scaleFactor };
+                layout.quadsCount++;
+            }
+
+            if (font.chars[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
+            else textOffsetX += ((float)font.chars[index].advanceX*scaleFactor + spacing);
+        }
+
+        i += codepointByteCount;
+    }
+
+    return layout;
+}
+
+// Unload text layout data (RAM)
+void UnloadTextLayout(TextLayout layout)
+{
+    RL_FREE(layout.sources);
+    RL_FREE(layout.dests);
+}
+
+// Draw text layout: texture bound once, all glyph quads sent in a single batch (split only if batch gets full)
+void DrawTextLayout(TextLayout layout, Vector2 position, Color tint)
+{
+    if ((layout.texture.id == 0) || (layout.quadsCount == 0)) return;
+
+    rlEnableTexture(layout.texture.id);
+
+    for (int first = 0; first < layout.quadsCount; first += MAX_TEXT_LAYOUT_BATCH_QUADS)
+    {
+        int count = layout.quadsCount - first;
+        if (count > MAX_TEXT_LAYOUT_BATCH_QUADS) count = MAX_TEXT_LAYOUT_BATCH_QUADS;
+
+        if (rlCheckRenderBatchLimit(4*count)) rlEnableTexture(layout.texture.id);
+
+        rlBegin(RL_QUADS);
+            rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+            rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+
+            for (int i = first; i < first + count; i++)
+            {
+                Rectangle src = layout.sources[i];
+                Rectangle dst = { position.x + layout.dests[i].x, position.y + layout.dests[i].y, layout.dests[i].width, layout.dests[i].height };
+
+                // Same corners order as DrawTexturePro()
+                rlTexCoord2f(src.x, src.y);
+                rlVertex2f(dst.x, dst.y);
+                rlTexCoord2f(src.x, src.y + src.height);
+                rlVertex2f(dst.x, dst.y + dst.height);
+                rlTexCoord2f(src.x + src.width, src.y + src.height);
+                rlVertex2f(dst.x + dst.width, dst.y + dst.height);
+                rlTexCoord2f(src.x + src.width, src.y);
+                rlVertex2f(dst.x + dst.width, dst.y);
+            }
+        rlEnd();
+    }
+
+    rlDisableTexture();
+}
+
 // Draw text using font inside rectangle limits
 void DrawTextRec(Font font, const char *text, Rectangle rec, float fontSize, float spacing, bool wordWrap, Color tint)
 {
@@ -1122,6 +1388,31 @@ int GetGlyphIndex(Font font, int codepoint)
     #define GLYPH_NOTFOUND_CHAR_FALLBACK     63      // Character used if requested codepoint is not found: '?'
 #endif
 
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    // Dynamic font lookup, glyph loaded if required
+    if (font.atlas != NULL) return LoadFontAtlasGlyph(font, codepoint);
+#endif
+
+    // Lookup index built on font loading
+    if (font.glyphIndex != NULL)
+    {
+        if ((codepoint >= 0) && (codepoint < GLYPH_INDEX_DIRECT_CODEPOINTS)) return (font.glyphIndex[codepoint] >= 0)? font.glyphIndex[codepoint] : GLYPH_NOTFOUND_CHAR_FALLBACK;
+
+        // Binary search of first entry with codepoint (duplicated codepoints are ordered by glyph index)
+        const int *others = font.glyphIndex + GLYPH_INDEX_DIRECT_CODEPOINTS + 1;
+        int first = 0, last = font.glyphIndex[GLYPH_INDEX_DIRECT_CODEPOINTS];
+
+        while (first < last)
+        {
+            int middle = (first + last)/2;
+
+            if (others[middle*2] < codepoint) first = middle + 1;
+            else last = middle;
+        }
+
+        return ((first < font.glyphIndex[GLYPH_INDEX_DIRECT_CODEPOINTS]) && (others[first*2] == codepoint))? others[first*2 + 1] : GLYPH_NOTFOUND_CHAR_FALLBACK;
+    }
+
 // Support charsets with any characters order
 #define SUPPORT_UNORDERED_CHARSET
 #if defined(SUPPORT_UNORDERED_CHARSET)
@@ -1851,6 +2142,8 @@ static Font LoadBMFont(const char *fileName)
     UnloadImage(imFont);
     RL_FREE(fileText);
 
+    UpdateFontGlyphIndex(&font);
+
     if (font.texture.id == 0)
     {
         UnloadFont(font);
@@ -1862,3 +2155,210 @@ static Font LoadBMFont(const char *fileName)
     return font;
 }
 #endif
+
+// Compare glyph index entries (codepoint, glyph index) for qsort()
+static int CompareGlyphCodepoints(const void *a, const void *b)
+{
+    const int *entryA = (const int *)a;
+    const int *entryB = (const int *)b;
+
+    if (entryA[0] != entryB[0]) return (entryA[0] < entryB[0])? -1 : 1;
+
+    return (entryA[1] < entryB[1])? -1 : ((entryA[1] > entryB[1])? 1 : 0);
+}
+
+// Get font texture, dynamic font atlas rows modified since last call are updated first
+static Texture2D GetFontTexture(Font font)
+{
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if (font.atlas != NULL)
+    {
+        rFontAtlas *atlas = font.atlas;
+
+        if (atlas->dirtyBottom > 0)
+        {
+            // NOTE: Full width rows are contiguous in atlas image, updated at once
+            rlUpdateTexture(atlas->texture.id, 0, atlas->dirtyTop, atlas->image.width, atlas->dirtyBottom - atlas->dirtyTop, atlas->image.format,
+                            (unsigned char *)atlas->image.data + atlas->dirtyTop*atlas->image.width*2);
+            atlas->dirtyBottom = 0;
+        }
+
+        return atlas->texture;
+    }
+#endif
+
+    return font.texture;
+}
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Rasterize one glyph: image (GRAYSCALE) and metrics
+// NOTE: Font info is only read, glyphs can be rasterized from multiple threads
+static void LoadGlyph(const stbtt_fontinfo *fontInfo, float scaleFactor, int ascent, int fontSize, int type, int codepoint, CharInfo *glyph)
+{
+    int chw = 0, chh = 0;   // Character width and height (on generation)
+    glyph->value = codepoint;
+
+    //  Render a unicode codepoint to a bitmap
+    //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
+    //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
+    //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
+
+    if (type != FONT_SDF) glyph->image.data = stbtt_GetCodepointBitmap(fontInfo, scaleFactor, scaleFactor, codepoint, &chw, &chh, &glyph->offsetX, &glyph->offsetY);
+    else if (codepoint != 32) glyph->image.data = stbtt_GetCodepointSDF(fontInfo, scaleFactor, codepoint, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &glyph->offsetX, &glyph->offsetY);
+    else glyph->image.data = NULL;
+
+    stbtt_GetCodepointHMetrics(fontInfo, codepoint, &glyph->advanceX, NULL);
+    glyph->advanceX = (int)((float)glyph->advanceX*scaleFactor);
+
+    // Load characters images
+    glyph->image.width = chw;
+    glyph->image.height = chh;
+    glyph->image.mipmaps = 1;
+    glyph->image.format = UNCOMPRESSED_GRAYSCALE;
+
+    glyph->offsetY += (int)((float)ascent*scaleFactor);
+
+    // NOTE: We create an empty image for space character, it could be further required for atlas packing
+    if (codepoint == 32)
+    {
+        Image imSpace = {
+            .data = calloc(glyph->advanceX*fontSize, 2),
+            .width = glyph->advanceX,
+            .height = fontSize,
+            .format = UNCOMPRESSED_GRAYSCALE,
+            .mipmaps = 1
+        };
+
+        glyph->image = imSpace;
+    }
+
+    if (type == FONT_BITMAP)
+    {
+        // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
+        // NOTE: For optimum results, bitmap font should be generated at base pixel size
+        for (int p = 0; p < chw*chh; p++)
+        {
+            if (((unsigned char *)glyph->image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)glyph->image.data)[p] = 0;
+            else ((unsigned char *)glyph->image.data)[p] = 255;
+        }
+    }
+
+    // Get bounding box for character (may be offset to account for chars that dip above or below the line)
+    /*
+    int chX1, chY1, chX2, chY2;
+    stbtt_GetCodepointBitmapBox(fontInfo, codepoint, scaleFactor, scaleFactor, &chX1, &chY1, &chX2, &chY2);
+
+    TRACELOGD("FONT: Character box measures: %i, %i, %i, %i", chX1, chY1, chX2 - chX1, chY2 - chY1);
+    TRACELOGD("FONT: Character offsetY: %i", (int)((float)ascent*scaleFactor) + chY1);
+    */
+}
+
+// Rasterization job: glyphs of chars range
+static void LoadGlyphsRange(void *data)
+{
+    FontGlyphsJob *job = (FontGlyphsJob *)data;
+
+    for (int i = job->firstChar; i < (job->firstChar + job->charsCount); i++)
+    {
+        LoadGlyph(job->fontInfo, job->scaleFactor, job->ascent, job->fontSize, job->type, job->fontChars[i], &job->chars[i]);
+    }
+}
+
+// Get glyph index on dynamic font, glyph rasterized and packed into atlas on first use
+// NOTE: Codepoints not available in font (or not packed, atlas full) point to fallback glyph: index 0
+static int LoadFontAtlasGlyph(Font font, int codepoint)
+{
+    rFontAtlas *atlas = font.atlas;
+
+    // Codepoints lookup, linear probing
+    unsigned int slot = ((unsigned int)codepoint*2654435761u)%FONT_DYNAMIC_LOOKUP_SLOTS;
+
+    while (atlas->lookup[slot*2 + 1] >= 0)
+    {
+        if (atlas->lookup[slot*2] == codepoint) return atlas->lookup[slot*2 + 1];
+        slot = (slot + 1)%FONT_DYNAMIC_LOOKUP_SLOTS;
+    }
+
+    // NOTE: Lookup is kept half empty at most, further codepoints are not loaded
+    if (atlas->lookupCount >= MAX_FONT_DYNAMIC_GLYPHS) return 0;
+
+    int index = 0;
+
+    if ((atlas->glyphsCount == 0) || (stbtt_FindGlyphIndex(&atlas->fontInfo, codepoint) > 0))
+    {
+        CharInfo glyph = { 0 };
+        LoadGlyph(&atlas->fontInfo, atlas->scaleFactor, atlas->ascent, font.baseSize, atlas->type, codepoint, &glyph);
+
+        stbrp_rect rect = { 0 };
+        rect.w = glyph.image.width + 2*font.charsPadding;
+        rect.h = glyph.image.height + 2*font.charsPadding;
+        stbrp_pack_rects(&atlas->packer, &rect, 1);
+
+        // Atlas height doubled until glyph is packed
+        // NOTE: Packer skyline does not depend on atlas height, only checked as limit
+        while (!rect.was_packed && ((atlas->image.height*2) <= MAX_FONT_DYNAMIC_ATLAS_SIZE))
+        {
+            int height = atlas->image.height*2;
+            unsigned char *pixels = (unsigned char *)RL_REALLOC(atlas->image.data, atlas->image.width*height*2);
+
+            if (pixels == NULL) break;
+
+            for (int i = atlas->image.width*atlas->image.height; i < atlas->image.width*height; i++)
+            {
+                pixels[i*2] = 255;
+                pixels[i*2 + 1] = 0;
+            }
+
+            atlas->image.data = pixels;
+            atlas->image.height = height;
+            atlas->packer.height = height;
+
+            // NOTE: Glyphs quads already batched use previous texture, drawn before unloading it
+            rlglDraw();
+            UnloadTexture(atlas->texture);
+            atlas->texture = LoadTextureFromImage(atlas->image);
+            SetTextureFilter(atlas->texture, (atlas->type == FONT_SDF)? FILTER_BILINEAR : FILTER_POINT);
+            atlas->dirtyBottom = 0;
+
+            TRACELOG(LOG_INFO, "FONT: Dynamic font atlas grown (%ix%i)", atlas->image.width, atlas->image.height);
+
+            stbrp_pack_rects(&atlas->packer, &rect, 1);
+        }
+
+        if (rect.was_packed)
+        {
+            index = atlas->glyphsCount;
+            font.recs[index] = (Rectangle){ (float)(rect.x + font.charsPadding), (float)(rect.y + font.charsPadding), (float)glyph.image.width, (float)glyph.image.height };
+
+            unsigned char *pixels = (unsigned char *)atlas->image.data;
+
+            for (int y = 0; y < glyph.image.height; y++)
+            {
+                unsigned char *row = pixels + ((rect.y + font.charsPadding + y)*atlas->image.width + rect.x + font.charsPadding)*2;
+                for (int x = 0; x < glyph.image.width; x++) row[x*2 + 1] = ((unsigned char *)glyph.image.data)[y*glyph.image.width + x];
+            }
+
+            // Update glyph image to use alpha, required to be used on ImageDrawText()
+            UnloadImage(glyph.image);
+            glyph.image = ImageFromImage(atlas->image, font.recs[index]);
+            font.chars[index] = glyph;
+            atlas->glyphsCount++;
+
+            if (atlas->dirtyBottom == 0) atlas->dirtyTop = rect.y;
+            else if (rect.y < atlas->dirtyTop) atlas->dirtyTop = rect.y;
+            if ((rect.y + rect.h) > atlas->dirtyBottom) atlas->dirtyBottom = rect.y + rect.h;
+        }
+        else
+        {
+            UnloadImage(glyph.image);
+            TRACELOG(LOG_WARNING, "FONT: Dynamic font atlas full, failed to package character (%i)", codepoint);
+        }
+    }
+
+    atlas->lookup[slot*2] = codepoint;
+    atlas->lookup[slot*2 + 1] = index;
+    atlas->lookupCount++;
+
+    return index;
+}
+#endif
@@ -30,6 +30,19 @@
 *   #define SUPPORT_IMAGE_GENERATION
 *       Support procedural image generation functionality (gradient, spot, perlin-noise, cellular)
 *
+*   #define SUPPORT_IMAGE_FORMAT_FAST
+*       Support ImageFormat() fast paths for common conversions (8 bit RGB/RGBA, grayscale, 16 bit, float),
+*       vectorized with SSE2/SSSE3/AVX2 when enabled by compiler, bit-exact with generic conversion
+*       (fast paths can be disabled with SetImageFormatFast() to check them against generic conversion)
+*
+*   #define SUPPORT_IMAGE_PARALLEL
+*       Support multi-threaded ImageResize() and ImageMipmaps(), output image split in row strips processed
+*       by multiple threads, threads count can be set with SetImageProcessingThreads()
+*
+*   #define SUPPORT_IMAGE_COMPRESSION
+*       Support ImageFormat() conversion from/to DXT compressed formats (BC1/BC2/BC3) on CPU and export
+*       as DDS file, 4x4 blocks encoded in parallel, quality set with SetImageCompressionQuality()
+*
 *   DEPENDENCIES:
 *       stb_image        - Multiple image formats loading (JPEG, PNG, BMP, TGA, PSD, GIF, PIC)
 *                          NOTE: stb_image has been slightly modified to support Android platform.
@@ -68,10 +81,27 @@
 #include <stdio.h>              // Required for: FILE, fopen(), fclose(), fread()
 #include <string.h>             // Required for: strlen() [Used in ImageTextEx()]
 #include <math.h>               // Required for: fabsf()
+#include <limits.h>             // Required for: INT_MIN [GenImagePerlinNoise()]
 
 #include "utils.h"              // Required for: fopen() Android mapping
 
 #include "rlgl.h"               // raylib OpenGL abstraction layer to OpenGL 1.1, 3.3 or ES2
+
+#if defined(SUPPORT_IMAGE_FORMAT_FAST) || defined(SUPPORT_IMAGE_COMPRESSION)
+    // SIMD instruction sets used by ImageFormat() fast paths, DXT compression and ImageDraw() blending, as enabled by compiler flags
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #define IMAGE_FORMAT_SSE2
+        #include <emmintrin.h>      // Required for: SSE2 intrinsics
+    #endif
+    #if defined(__SSSE3__) || defined(__AVX__)
+        #define IMAGE_FORMAT_SSSE3
+        #include <tmmintrin.h>      // Required for: _mm_shuffle_epi8()
+    #endif
+    #if defined(__AVX2__)
+        #define IMAGE_FORMAT_AVX2
+        #include <immintrin.h>      // Required for: AVX2 intrinsics
+    #endif
+#endif
                                 // Required for: rlLoadTexture() rlUnloadTexture(),
                                 // rlGenerateMipmaps(), some funcs for DrawTexturePro()
 
@@ -152,15 +182,75 @@
     #define UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD  50    // Threshold over 255 to set alpha as 0
 #endif
 
+#ifndef MAX_IMAGE_PARALLEL_MIN_PIXELS
+    #define MAX_IMAGE_PARALLEL_MIN_PIXELS       65536   // Minimum output pixels to split image processing between threads
+#endif
+#define IMAGE_PARALLEL_STRIP_ROWS                  16   // Minimum rows per strip processed by one thread
+#define IMAGE_PARALLEL_STRIPS_PER_THREAD            4   // Strips per thread, for load balancing
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// Image resize job, rows strip of the output image
+typedef struct ImageResizeJob {
+    const unsigned char *input;     // Input pixels (8 bit per channel)
+    int width;                      // Input width
+    int height;                     // Input height
+    unsigned char *output;          // Output pixels, full image
+    int newWidth;                   // Output width
+    int newHeight;                  // Output height
+    int channels;                   // Channels per pixel
+    int firstRow;                   // First output row of the strip
+    int rowsCount;                  // Output rows in the strip
+} ImageResizeJob;
+#endif
+
+#if defined(SUPPORT_IMAGE_COMPRESSION)
+// Image compression job, 4x4 blocks rows of one image level
+typedef struct ImageCompressionJob {
+    unsigned char *pixels;          // Uncompressed pixels (32 bit RGBA), full level
+    unsigned char *blocks;          // Compressed blocks, full level
+    int width;                      // Level width
+    int height;                     // Level height
+    int format;                     // Compressed format (DXT)
+    int quality;                    // Compression quality (CompressionQuality)
+    bool decompress;                // Blocks decoded to pixels, otherwise pixels encoded to blocks
+    int firstRow;                   // First blocks row of the job
+    int rowsCount;                  // Blocks rows in the job
+} ImageCompressionJob;
+#endif
+
+#if defined(SUPPORT_IMAGE_GENERATION)
+// Image generation job, rows strip of generated image
+typedef struct ImageGenerationJob {
+    Color *pixels;                  // Generated pixels, full image
+    int width;                      // Image width
+    int height;                     // Image height
+    int offsetX;                    // Perlin noise: horizontal offset
+    int offsetY;                    // Perlin noise: vertical offset
+    float scale;                    // Perlin noise: scale
+    const Vector2 *seeds;           // Cellular: cells seeds
+    int seedsPerRow;                // Cellular: seeds per row of tiles
+    int seedsPerCol;                // Cellular: seeds per column of tiles
+    int tileSize;                   // Cellular: tile size
+    int firstRow;                   // First row of the strip
+    int rowsCount;                  // Rows in the strip
+} ImageGenerationJob;
+
+// Perlin noise gradients of last lattice cell by octave, valid for one image row
+typedef struct PerlinNoiseCache {
+    int lattice[6];                 // Lattice cell x coordinate
+    unsigned char gradients[6][8];  // Cell corners gradients indices
+} PerlinNoiseCache;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// It's lonely here...
+static int imageThreads = 0;        // Threads used by image processing (0 = all available processors)
+static int imageCompressionQuality = COMPRESSION_NORMAL;    // Quality of DXT compression
+static bool imageFormatFast = true; // ImageFormat() fast paths enabled (disabled to check them against generic path)
 
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
@@ -172,6 +262,7 @@
 //----------------------------------------------------------------------------------
 #if defined(SUPPORT_FILEFORMAT_DDS)
 static Image LoadDDS(const unsigned char *fileData, unsigned int fileSize);   // Load DDS file data
+static int SaveDDS(Image image, const char *fileName);  // Save image data as DDS file
 #endif
 #if defined(SUPPORT_FILEFORMAT_PKM)
 static Image LoadPKM(const unsigned char *fileData, unsigned int fileSize);   // Load PKM file data
@@ -187,6 +278,27 @@ static Image LoadPVR(const unsigned char *fileData, unsigned int fileSize);   //
 static Image LoadASTC(const unsigned char *fileData, unsigned int fileSize);  // Load ASTC file data
 #endif
 static Vector4 *LoadImageDataNormalized(Image image);    // Load pixel data from image as Vector4 array (float normalized)
+#if defined(SUPPORT_IMAGE_FORMAT_FAST)
+static bool ImageFormatFast(Image *image, int newFormat);   // Convert image data without intermediate buffer (common formats only)
+#endif
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+static void ResizePixels(const unsigned char *input, int width, int height, unsigned char *output, int newWidth, int newHeight, int channels);  // Resize 8 bit per channel pixels (bicubic)
+static void ResizePixelsStrip(void *data);                  // Resize job: compute one rows strip of output image
+#endif
+#if defined(SUPPORT_IMAGE_COMPRESSION)
+static bool ImageFormatCompressed(Image *image, int newFormat);     // Convert image data from/to DXT compressed formats
+static void ProcessDXTLevel(unsigned char *pixels, unsigned char *blocks, int width, int height, int format, bool decompress);  // Compress or decompress one image level
+static void ProcessDXTBlockRows(void *data);                // Compression job: compress or decompress 4x4 blocks rows
+#endif
+static int GetPixelPacked(Color color, int format, unsigned char *pixel);  // Get color as destination format pixel bytes
+static void ImageFillSpan(Image *dst, int x, int y, int count, const unsigned char *pixel, int bytesPerPixel);  // Fill image row span with packed pixel (clipped)
+static void BlendPixelsRGBA(unsigned char *dst, const unsigned char *src, int count, Color tint);  // Alpha blend 32bit RGBA pixels row (as ColorAlphaBlend())
+#if defined(SUPPORT_IMAGE_GENERATION)
+static void GenImageRows(JobFunc func, ImageGenerationJob job);  // Run image generation job on rows strips, in parallel
+static void PerlinNoiseFbm4(const float *x, float y, PerlinNoiseCache *cache, float *noise);  // Perlin fbm noise for 4 points
+static void GenPerlinNoiseRows(void *data);                 // Generation job: perlin noise rows
+static void GenCellularRows(void *data);                    // Generation job: cellular rows
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -300,7 +412,8 @@ Image LoadImageFromMemory(const char *fileType, const unsigned char *fileData, i
     Image image = { 0 };
 
     char fileExtLower[16] = { 0 };
-    strcpy(fileExtLower, TextToLower(fileType));
+    // NOTE: Lowered locally, TextToLower() static buffer is not safe for loading from multiple threads
+    for (int i = 0; (i < 15) && (fileType[i] != '\0'); i++) fileExtLower[i] = ((fileType[i] >= 'A') && (fileType[i] <= 'Z'))? fileType[i] + 32 : fileType[i];
 
 #if defined(SUPPORT_FILEFORMAT_PNG)
     if ((TextIsEqual(fileExtLower, "png"))
@@ -430,6 +543,9 @@ bool ExportImage(Image image, const char *fileName)
 #if defined(SUPPORT_FILEFORMAT_JPG)
     else if (IsFileExtension(fileName, ".jpg")) success = stbi_write_jpg(fileName, image.width, image.height, channels, imgData, 90);  // JPG quality: between 1 and 100
 #endif
+#if defined(SUPPORT_FILEFORMAT_DDS)
+    else if (IsFileExtension(fileName, ".dds")) success = SaveDDS(image, fileName);
+#endif
 #if defined(SUPPORT_FILEFORMAT_KTX)
     else if (IsFileExtension(fileName, ".ktx")) success = SaveKTX(image, fileName);
 #endif
@@ -662,29 +778,13 @@ Image GenImageWhiteNoise(int width, int height, float factor)
 }
 
 // Generate image: perlin noise
+// NOTE: Rows strips generated in parallel, 4 pixels per noise evaluation if SIMD supported
 Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float scale)
 {
     Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
 
-    for (int y = 0; y < height; y++)
-    {
-        for (int x = 0; x < width; x++)
-        {
-            float nx = (float)(x + offsetX)*scale/(float)width;
-            float ny = (float)(y + offsetY)*scale/(float)height;
-
-            // Typical values to start playing with:
-            //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
-            //   gain       =  0.5   -- relative weighting applied to each successive octave
-            //   octaves    =  6     -- number of "octaves" of noise3() to sum
-
-            // NOTE: We need to translate the data from [-1..1] to [0..1]
-            float p = (stb_perlin_fbm_noise3(nx, ny, 1.0f, 2.0f, 0.5f, 6) + 1.0f)/2.0f;
-
-            int intensity = (int)(p*255.0f);
-            pixels[y*width + x] = (Color){intensity, intensity, intensity, 255};
-        }
-    }
+    ImageGenerationJob job = { pixels, width, height, offsetX, offsetY, scale, NULL, 0, 0, 0, 0, 0 };
+    GenImageRows(GenPerlinNoiseRows, job);
 
     Image image = {
         .data = pixels,
@@ -697,7 +797,8 @@ Image GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float
     return image;
 }
 
-// Generate image: cellular algorithm. Bigger tileSize means bigger cells
+// Generate image: cellular algorithm, cells seeds are randomly positioned inside image tiles
+// NOTE: Every pixel only checks seeds of its tile and adjacent tiles, rows strips generated in parallel
 Image GenImageCellular(int width, int height, int tileSize)
 {
     Color *pixels = (Color *)RL_MALLOC(width*height*sizeof(Color));
@@ -715,39 +816,8 @@ Image GenImageCellular(int width, int height, int tileSize)
         seeds[i] = (Vector2){ (float)x, (float)y};
     }
 
-    for (int y = 0; y < height; y++)
-    {
-        int tileY = y/tileSize;
-
-        for (int x = 0; x < width; x++)
-        {
-            int tileX = x/tileSize;
-
-            float minDistance = (float)strtod("Inf", NULL);
-
-            // Check all adjacent tiles
-            for (int i = -1; i < 2; i++)
-            {
-                if ((tileX + i < 0) || (tileX + i >= seedsPerRow)) continue;
-
-                for (int j = -1; j < 2; j++)
-                {
-                    if ((tileY + j < 0) || (tileY + j >= seedsPerCol)) continue;
-
-                    Vector2 neighborSeed = seeds[(tileY + j)*seedsPerRow + tileX + i];
-
-                    float dist = (float)hypot(x - (int)neighborSeed.x, y - (int)neighborSeed.y);
-                    minDistance = (float)fmin(minDistance, dist);
-                }
-            }
-
-            // I made this up but it seems to give good results at all tile sizes
-            int intensity = (int)(minDistance*256.0f/tileSize);
-            if (intensity > 255) intensity = 255;
-
-            pixels[y*width + x] = (Color){ intensity, intensity, intensity, 255 };
-        }
-    }
+    ImageGenerationJob job = { pixels, width, height, 0, 0, 0.0f, seeds, seedsPerRow, seedsPerCol, tileSize, 0, 0 };
+    GenImageRows(GenCellularRows, job);
 
     RL_FREE(seeds);
 
@@ -886,6 +956,12 @@ void ImageFormat(Image *image, int newFormat)
 
     if ((newFormat != 0) && (image->format != newFormat))
     {
+#if defined(SUPPORT_IMAGE_FORMAT_FAST)
+        if (imageFormatFast && ImageFormatFast(image, newFormat)) return;
+#endif
+#if defined(SUPPORT_IMAGE_COMPRESSION)
+        if (ImageFormatCompressed(image, newFormat)) return;
+#endif
         if ((image->format < COMPRESSED_DXT1_RGB) && (newFormat < COMPRESSED_DXT1_RGB))
         {
             Vector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
@@ -1054,6 +1130,20 @@ void ImageFormat(Image *image, int newFormat)
     }
 }
 
+// Set quality for image conversion to DXT compressed formats
+// NOTE: COMPRESSION_FAST is about 3x faster than COMPRESSION_HIGH, with lower PSNR
+void SetImageCompressionQuality(int quality)
+{
+    if ((quality >= COMPRESSION_FAST) && (quality <= COMPRESSION_HIGH)) imageCompressionQuality = quality;
+}
+
+// Enable ImageFormat() fast paths (enabled by default), generic conversion is used for every format when disabled
+// NOTE: Fast paths are bit-exact with generic conversion, disabling them allows to check it
+void SetImageFormatFast(bool enabled)
+{
+    imageFormatFast = enabled;
+}
+
 // Convert image to POT (power-of-two)
 // NOTE: It could be useful on OpenGL ES 2.0 (RPI, HTML5)
 void ImageToPOT(Image *image, Color fill)
@@ -1334,6 +1424,19 @@ void ImageAlphaPremultiply(Image *image)
     ImageFormat(image, format);
 }
 
+// Set threads count used by image processing (ImageResize(), ImageMipmaps())
+// NOTE: 0 uses all available processors, 1 processes images on calling thread
+void SetImageProcessingThreads(int count)
+{
+    imageThreads = (count < 0)? 0 : count;
+}
+
+// Get threads count used by image processing (0 = all available processors)
+int GetImageProcessingThreads(void)
+{
+    return imageThreads;
+}
+
 // Resize and image to new size
 // NOTE: Uses stb default scaling filters (both bicubic):
 // STBIR_DEFAULT_FILTER_UPSAMPLE    STBIR_FILTER_CATMULLROM
@@ -1353,10 +1456,10 @@ void ImageResize(Image *image, int newWidth, int newHeight)
 
         switch (image->format)
         {
-            case UNCOMPRESSED_GRAYSCALE: stbir_resize_uint8((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, 1); break;
-            case UNCOMPRESSED_GRAY_ALPHA: stbir_resize_uint8((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, 2); break;
-            case UNCOMPRESSED_R8G8B8: stbir_resize_uint8((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, 3); break;
-            case UNCOMPRESSED_R8G8B8A8: stbir_resize_uint8((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, 4); break;
+            case UNCOMPRESSED_GRAYSCALE: ResizePixels((unsigned char *)image->data, image->width, image->height, output, newWidth, newHeight, 1); break;
+            case UNCOMPRESSED_GRAY_ALPHA: ResizePixels((unsigned char *)image->data, image->width, image->height, output, newWidth, newHeight, 2); break;
+            case UNCOMPRESSED_R8G8B8: ResizePixels((unsigned char *)image->data, image->width, image->height, output, newWidth, newHeight, 3); break;
+            case UNCOMPRESSED_R8G8B8A8: ResizePixels((unsigned char *)image->data, image->width, image->height, output, newWidth, newHeight, 4); break;
             default: break;
         }
 
@@ -1372,7 +1475,7 @@ void ImageResize(Image *image, int newWidth, int newHeight)
         Color *output = (Color *)RL_MALLOC(newWidth*newHeight*sizeof(Color));
 
         // NOTE: Color data is casted to (unsigned char *), there shouldn't been any problem...
-        stbir_resize_uint8((unsigned char *)pixels, image->width, image->height, 0, (unsigned char *)output, newWidth, newHeight, 0, 4);
+        ResizePixels((unsigned char *)pixels, image->width, image->height, (unsigned char *)output, newWidth, newHeight, 4);
 
         int format = image->format;
 
@@ -1520,32 +1623,73 @@ void ImageMipmaps(Image *image)
         // Pointer to allocated memory point where store next mipmap level data
         unsigned char *nextmip = (unsigned char *)image->data + GetPixelDataSize(image->width, image->height, image->format);
 
-        mipWidth = image->width/2;
-        mipHeight = image->height/2;
-        mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);
-        Image imCopy = ImageCopy(*image);
+        int channels = 0;
+        switch (image->format)
+        {
+            case UNCOMPRESSED_GRAYSCALE: channels = 1; break;
+            case UNCOMPRESSED_GRAY_ALPHA: channels = 2; break;
+            case UNCOMPRESSED_R8G8B8: channels = 3; break;
+            case UNCOMPRESSED_R8G8B8A8: channels = 4; break;
+            default: break;
+        }
 
-        for (int i = 1; i < mipCount; i++)
+        if (channels > 0)
         {
-            TRACELOGD("IMAGE: Generating mipmap level: %i (%i x %i) - size: %i - offset: 0x%x", i, mipWidth, mipHeight, mipSize, nextmip);
+            // Every mipmap level is resized from previous level, directly into image data
+            unsigned char *prevmip = (unsigned char *)image->data;
+            int prevWidth = image->width;
+            int prevHeight = image->height;
+
+            mipWidth = image->width;
+            mipHeight = image->height;
 
-            ImageResize(&imCopy, mipWidth, mipHeight);  // Uses internally Mitchell cubic downscale filter
+            for (int i = 1; i < mipCount; i++)
+            {
+                if (mipWidth != 1) mipWidth /= 2;
+                if (mipHeight != 1) mipHeight /= 2;
 
-            memcpy(nextmip, imCopy.data, mipSize);
-            nextmip += mipSize;
-            image->mipmaps++;
+                mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);
 
-            mipWidth /= 2;
-            mipHeight /= 2;
+                TRACELOGD("IMAGE: Generating mipmap level: %i (%i x %i) - size: %i - offset: 0x%x", i, mipWidth, mipHeight, mipSize, nextmip);
 
-            // Security check for NPOT textures
-            if (mipWidth < 1) mipWidth = 1;
-            if (mipHeight < 1) mipHeight = 1;
+                ResizePixels(prevmip, prevWidth, prevHeight, nextmip, mipWidth, mipHeight, channels);  // Uses internally Mitchell cubic downscale filter
 
-            mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);
+                prevmip = nextmip;
+                prevWidth = mipWidth;
+                prevHeight = mipHeight;
+                nextmip += mipSize;
+                image->mipmaps++;
+            }
         }
+        else
+        {
+            mipWidth = image->width/2;
+            mipHeight = image->height/2;
+            mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);
+            Image imCopy = ImageCopy(*image);
+
+            for (int i = 1; i < mipCount; i++)
+            {
+                TRACELOGD("IMAGE: Generating mipmap level: %i (%i x %i) - size: %i - offset: 0x%x", i, mipWidth, mipHeight, mipSize, nextmip);
+
+                ImageResize(&imCopy, mipWidth, mipHeight);  // Uses internally Mitchell cubic downscale filter
+
+                memcpy(nextmip, imCopy.data, mipSize);
+                nextmip += mipSize;
+                image->mipmaps++;
+
+                mipWidth /= 2;
+                mipHeight /= 2;
+
+                // Security check for NPOT textures
+                if (mipWidth < 1) mipWidth = 1;
+                if (mipHeight < 1) mipHeight = 1;
 
-        UnloadImage(imCopy);
+                mipSize = GetPixelDataSize(mipWidth, mipHeight, image->format);
+            }
+
+            UnloadImage(imCopy);
+        }
     }
     else TRACELOG(LOG_WARNING, "IMAGE: Mipmaps already available");
 }
@@ -2012,6 +2156,10 @@ Color *LoadImageColors(Image image)
 
     Color *pixels = (Color *)RL_MALLOC(image.width*image.height*sizeof(Color));
 
+#if defined(SUPPORT_IMAGE_COMPRESSION)
+    if ((image.format >= COMPRESSED_DXT1_RGB) && (image.format <= COMPRESSED_DXT5_RGBA)) ProcessDXTLevel((unsigned char *)pixels, (unsigned char *)image.data, image.width, image.height, image.format, true);
+    else
+#endif
     if (image.format >= COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
     else
     {
@@ -2190,165 +2338,1597 @@ void UnloadImagePalette(Color *colors)
     RL_FREE(colors);
 }
 
-// Get pixel data from image as Vector4 array (float normalized)
-static Vector4 *LoadImageDataNormalized(Image image)
-{
-    Vector4 *pixels = (Vector4 *)RL_MALLOC(image.width*image.height*sizeof(Vector4));
-
-    if (image.format >= COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
-    else
-    {
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
-        {
-            switch (image.format)
-            {
-                case UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].w = 1.0f;
-
-                } break;
-                case UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-
-                    k += 2;
-                } break;
-                case UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
-                    pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
-                    pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
-
-                } break;
-                case UNCOMPRESSED_R5G6B5:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
-
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
-                    pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
-                    pixels[i].w = 1.0f;
-
-                } break;
-                case UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+#if defined(SUPPORT_IMAGE_FORMAT_FAST)
+// Pixel format conversion fast paths: common conversions done directly, without float Vector4 intermediate buffer
+// NOTE: Results are bit-exact with generic path, float expressions are replaced by exhaustively checked integer equivalents:
+//   8 bit channel:        (unsigned char)((v/255.0f)*255.0f) == v
+//   8 bit to n bit:       (unsigned char)round((v/255.0f)*m) == (v*m + 127)/255, m = 15, 31, 63
+//   n bit to 8 bit:       (unsigned char)(v*(1.0f/m)*255.0f) == v*255/m
+//   float to 8 bit:       (unsigned char)(f*255.0f) keeps the low byte of the int32 conversion (as x86 scalar code)
+// Grayscale conversion keeps the float computation order of the generic path (not bit-exact if compiler contracts it to FMA)
 
-                    pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
-                    pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
-                    pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
-                    pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
+// Convert n bit channel value to 8 bit (v*255/m)
+static inline unsigned char Expand4(int v) { return (unsigned char)(v*17); }
+static inline unsigned char Expand5(int v) { return (unsigned char)((v*2106) >> 8); }
+static inline unsigned char Expand6(int v) { return (unsigned char)(4*v + ((v*49) >> 10)); }
 
-                } break;
-                case UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 3]/255.0f;
+// Convert 8 bit channel value to n bit (round(v*m/255))
+static inline unsigned short Reduce(int v, int m) { int n = v*m + 127; return (unsigned short)((n + 1 + (n >> 8)) >> 8); }
 
-                    k += 4;
-                } break;
-                case UNCOMPRESSED_R8G8B8:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = 1.0f;
+static void PixelsRGBToRGBA(const unsigned char *src, unsigned char *dst, int count)
+{
+    int i = 0;
+#if defined(IMAGE_FORMAT_SSSE3)
+    const __m128i shuffle = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m128i alpha = _mm_set1_epi32((int)0xff000000);
 
-                    k += 3;
-                } break;
-                case UNCOMPRESSED_R32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = 0.0f;
-                    pixels[i].z = 0.0f;
-                    pixels[i].w = 1.0f;
+    for (; i + 6 <= count; i += 4)     // 16 bytes loaded, 12 used
+    {
+        __m128i rgb = _mm_loadu_si128((const __m128i *)(src + 3*i));
+        _mm_storeu_si128((__m128i *)(dst + 4*i), _mm_or_si128(_mm_shuffle_epi8(rgb, shuffle), alpha));
+    }
+#endif
+    for (; i < count; i++)
+    {
+        dst[4*i] = src[3*i];
+        dst[4*i + 1] = src[3*i + 1];
+        dst[4*i + 2] = src[3*i + 2];
+        dst[4*i + 3] = 255;
+    }
+}
 
-                } break;
-                case UNCOMPRESSED_R32G32B32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = 1.0f;
+static void PixelsRGBAToRGB(const unsigned char *src, unsigned char *dst, int count)
+{
+    int i = 0;
+#if defined(IMAGE_FORMAT_SSSE3)
+    const __m128i shuffle = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
 
-                    k += 3;
-                } break;
-                case UNCOMPRESSED_R32G32B32A32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = ((float *)image.data)[k + 3];
+    for (; i + 6 <= count; i += 4)     // 16 bytes stored, last 4 overwritten by next pixels
+    {
+        __m128i rgba = _mm_loadu_si128((const __m128i *)(src + 4*i));
+        _mm_storeu_si128((__m128i *)(dst + 3*i), _mm_shuffle_epi8(rgba, shuffle));
+    }
+#endif
+    for (; i < count; i++)
+    {
+        dst[3*i] = src[4*i];
+        dst[3*i + 1] = src[4*i + 1];
+        dst[3*i + 2] = src[4*i + 2];
+    }
+}
 
-                    k += 4;
-                }
-                default: break;
-            }
+// RGBA to grayscale (alpha optional), same float operations as generic path
+static void PixelsRGBAToGray(const unsigned char *src, unsigned char *dst, int count, bool alpha)
+{
+    int i = 0;
+#if defined(IMAGE_FORMAT_SSE2)
+    const __m128i mask = _mm_set1_epi32(0xff);
+    const __m128 v255 = _mm_set1_ps(255.0f);
+    const __m128 cr = _mm_set1_ps(0.299f);
+    const __m128 cg = _mm_set1_ps(0.587f);
+    const __m128 cb = _mm_set1_ps(0.114f);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i rgba = _mm_loadu_si128((const __m128i *)(src + 4*i));
+        __m128 r = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(rgba, mask)), v255);
+        __m128 g = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(rgba, 8), mask)), v255);
+        __m128 b = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(rgba, 16), mask)), v255);
+        __m128 y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r, cr), _mm_mul_ps(g, cg)), _mm_mul_ps(b, cb));
+        __m128i gray = _mm_cvttps_epi32(_mm_mul_ps(y, v255));
+        gray = _mm_packs_epi32(gray, gray);
+
+        if (alpha)
+        {
+            __m128i a = _mm_srli_epi32(rgba, 24);
+            a = _mm_packs_epi32(a, a);
+            _mm_storel_epi64((__m128i *)(dst + 2*i), _mm_or_si128(gray, _mm_slli_epi16(a, 8)));
+        }
+        else
+        {
+            int value = _mm_cvtsi128_si32(_mm_packus_epi16(gray, gray));
+            memcpy(dst + i, &value, 4);
         }
     }
+#endif
+    for (; i < count; i++)
+    {
+        float r = (float)src[4*i]/255.0f;
+        float g = (float)src[4*i + 1]/255.0f;
+        float b = (float)src[4*i + 2]/255.0f;
+        unsigned char gray = (unsigned char)((r*0.299f + g*0.587f + b*0.114f)*255.0f);
 
-    return pixels;
+        if (alpha)
+        {
+            dst[2*i] = gray;
+            dst[2*i + 1] = src[4*i + 3];
+        }
+        else dst[i] = gray;
+    }
 }
 
-// Get image alpha border rectangle
-// NOTE: Threshold is defined as a percentatge: 0.0f -> 1.0f
-Rectangle GetImageAlphaBorder(Image image, float threshold)
+// Grayscale (alpha optional) to RGBA
+static void PixelsGrayToRGBA(const unsigned char *src, unsigned char *dst, int count, bool alpha)
 {
-    Rectangle crop = { 0 };
-
-    Color *pixels = LoadImageColors(image);
-
-    if (pixels != NULL)
+    int i = 0;
+#if defined(IMAGE_FORMAT_SSE2)
+    if (alpha)
     {
-        int xMin = 65536;   // Define a big enough number
-        int xMax = 0;
-        int yMin = 65536;
-        int yMax = 0;
+        const __m128i mask = _mm_set1_epi16(0xff);
 
-        for (int y = 0; y < image.height; y++)
+        for (; i + 8 <= count; i += 8)
         {
-            for (int x = 0; x < image.width; x++)
-            {
-                if (pixels[y*image.width + x].a > (unsigned char)(threshold*255.0f))
-                {
-                    if (x < xMin) xMin = x;
-                    if (x > xMax) xMax = x;
-                    if (y < yMin) yMin = y;
-                    if (y > yMax) yMax = y;
-                }
-            }
+            __m128i ga = _mm_loadu_si128((const __m128i *)(src + 2*i));
+            __m128i g = _mm_and_si128(ga, mask);
+            __m128i gg = _mm_or_si128(g, _mm_slli_epi16(g, 8));
+            _mm_storeu_si128((__m128i *)(dst + 4*i), _mm_unpacklo_epi16(gg, ga));
+            _mm_storeu_si128((__m128i *)(dst + 4*i + 16), _mm_unpackhi_epi16(gg, ga));
         }
+    }
+    else
+    {
+        const __m128i opaque = _mm_set1_epi32((int)0xff000000);
 
-        // Check for empty blank image
-        if ((xMin != 65536) && (xMax != 65536))
+        for (; i + 16 <= count; i += 16)
         {
-            crop = (Rectangle){ (float)xMin, (float)yMin, (float)((xMax + 1) - xMin), (float)((yMax + 1) - yMin) };
+            __m128i g = _mm_loadu_si128((const __m128i *)(src + i));
+            __m128i lo = _mm_unpacklo_epi8(g, g);
+            __m128i hi = _mm_unpackhi_epi8(g, g);
+            _mm_storeu_si128((__m128i *)(dst + 4*i), _mm_or_si128(_mm_unpacklo_epi16(lo, lo), opaque));
+            _mm_storeu_si128((__m128i *)(dst + 4*i + 16), _mm_or_si128(_mm_unpackhi_epi16(lo, lo), opaque));
+            _mm_storeu_si128((__m128i *)(dst + 4*i + 32), _mm_or_si128(_mm_unpacklo_epi16(hi, hi), opaque));
+            _mm_storeu_si128((__m128i *)(dst + 4*i + 48), _mm_or_si128(_mm_unpackhi_epi16(hi, hi), opaque));
         }
-
-        UnloadImageColors(pixels);
     }
-
-    return crop;
+#endif
+    for (; i < count; i++)
+    {
+        unsigned char g = alpha? src[2*i] : src[i];
+        dst[4*i] = g;
+        dst[4*i + 1] = g;
+        dst[4*i + 2] = g;
+        dst[4*i + 3] = alpha? src[2*i + 1] : 255;
+    }
 }
 
-//------------------------------------------------------------------------------------
-// Image drawing functions
-//------------------------------------------------------------------------------------
+// RGBA to 16 bit formats: R5G6B5, R5G5B5A1, R4G4B4A4
+static void PixelsRGBATo16(const unsigned char *src, unsigned short *dst, int count, int format)
+{
+    int i = 0;
+#if defined(IMAGE_FORMAT_SSE2)
+    const __m128i mask = _mm_set1_epi32(0xff);
+    const __m128i bias = _mm_set1_epi16(127);
+    const __m128i one = _mm_set1_epi16(1);
+    const __m128i threshold = _mm_set1_epi16(UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i p0 = _mm_loadu_si128((const __m128i *)(src + 4*i));
+        __m128i p1 = _mm_loadu_si128((const __m128i *)(src + 4*i + 16));
+
+        // Channels as 16 bit lanes (8 pixels)
+        __m128i r = _mm_packs_epi32(_mm_and_si128(p0, mask), _mm_and_si128(p1, mask));
+        __m128i g = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(p0, 8), mask), _mm_and_si128(_mm_srli_epi32(p1, 8), mask));
+        __m128i b = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(p0, 16), mask), _mm_and_si128(_mm_srli_epi32(p1, 16), mask));
+        __m128i a = _mm_packs_epi32(_mm_srli_epi32(p0, 24), _mm_srli_epi32(p1, 24));
+
+        // (v*m + 127)/255, exact division: (n + 1 + (n >> 8)) >> 8
+        #define REDUCE_EPI16(v, m) _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(v, _mm_set1_epi16(m)), bias), one), \
+                                                  _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(v, _mm_set1_epi16(m)), bias), 8)), 8)
+        __m128i result;
+        if (format == UNCOMPRESSED_R5G6B5) result = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(REDUCE_EPI16(r, 31), 11), _mm_slli_epi16(REDUCE_EPI16(g, 63), 5)), REDUCE_EPI16(b, 31));
+        else if (format == UNCOMPRESSED_R5G5B5A1) result = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(REDUCE_EPI16(r, 31), 11), _mm_slli_epi16(REDUCE_EPI16(g, 31), 6)),
+                                                                       _mm_or_si128(_mm_slli_epi16(REDUCE_EPI16(b, 31), 1), _mm_and_si128(_mm_cmpgt_epi16(a, threshold), one)));
+        else result = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(REDUCE_EPI16(r, 15), 12), _mm_slli_epi16(REDUCE_EPI16(g, 15), 8)),
+                                   _mm_or_si128(_mm_slli_epi16(REDUCE_EPI16(b, 15), 4), REDUCE_EPI16(a, 15)));
+        #undef REDUCE_EPI16
+
+        _mm_storeu_si128((__m128i *)(dst + i), result);
+    }
+#endif
+    for (; i < count; i++)
+    {
+        const unsigned char *p = src + 4*i;
+
+        if (format == UNCOMPRESSED_R5G6B5) dst[i] = Reduce(p[0], 31) << 11 | Reduce(p[1], 63) << 5 | Reduce(p[2], 31);
+        else if (format == UNCOMPRESSED_R5G5B5A1) dst[i] = Reduce(p[0], 31) << 11 | Reduce(p[1], 31) << 6 | Reduce(p[2], 31) << 1 | ((p[3] > UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD)? 1 : 0);
+        else dst[i] = Reduce(p[0], 15) << 12 | Reduce(p[1], 15) << 8 | Reduce(p[2], 15) << 4 | Reduce(p[3], 15);
+    }
+}
+
+// 16 bit formats to RGBA: R5G6B5, R5G5B5A1, R4G4B4A4
+static void Pixels16ToRGBA(const unsigned short *src, unsigned char *dst, int count, int format)
+{
+    int i = 0;
+#if defined(IMAGE_FORMAT_SSE2)
+    const __m128i mask4 = _mm_set1_epi16(0x0f);
+    const __m128i mask5 = _mm_set1_epi16(0x1f);
+    const __m128i mask6 = _mm_set1_epi16(0x3f);
+    const __m128i one = _mm_set1_epi16(1);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i p = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i r, g, b, a;
+
+        // Channels expanded to 8 bit in 16 bit lanes (same integer expressions as Expand*())
+        #define EXPAND4_EPI16(v) _mm_mullo_epi16(v, _mm_set1_epi16(17))
+        #define EXPAND5_EPI16(v) _mm_srli_epi16(_mm_mullo_epi16(v, _mm_set1_epi16(2106)), 8)
+        #define EXPAND6_EPI16(v) _mm_add_epi16(_mm_slli_epi16(v, 2), _mm_srli_epi16(_mm_mullo_epi16(v, _mm_set1_epi16(49)), 10))
+        if (format == UNCOMPRESSED_R5G6B5)
+        {
+            r = EXPAND5_EPI16(_mm_srli_epi16(p, 11));
+            g = EXPAND6_EPI16(_mm_and_si128(_mm_srli_epi16(p, 5), mask6));
+            b = EXPAND5_EPI16(_mm_and_si128(p, mask5));
+            a = _mm_set1_epi16(255);
+        }
+        else if (format == UNCOMPRESSED_R5G5B5A1)
+        {
+            r = EXPAND5_EPI16(_mm_srli_epi16(p, 11));
+            g = EXPAND5_EPI16(_mm_and_si128(_mm_srli_epi16(p, 6), mask5));
+            b = EXPAND5_EPI16(_mm_and_si128(_mm_srli_epi16(p, 1), mask5));
+            a = _mm_mullo_epi16(_mm_and_si128(p, one), _mm_set1_epi16(255));
+        }
+        else
+        {
+            r = EXPAND4_EPI16(_mm_srli_epi16(p, 12));
+            g = EXPAND4_EPI16(_mm_and_si128(_mm_srli_epi16(p, 8), mask4));
+            b = EXPAND4_EPI16(_mm_and_si128(_mm_srli_epi16(p, 4), mask4));
+            a = EXPAND4_EPI16(_mm_and_si128(p, mask4));
+        }
+        #undef EXPAND4_EPI16
+        #undef EXPAND5_EPI16
+        #undef EXPAND6_EPI16
+
+        __m128i rg = _mm_or_si128(r, _mm_slli_epi16(g, 8));
+        __m128i ba = _mm_or_si128(b, _mm_slli_epi16(a, 8));
+        _mm_storeu_si128((__m128i *)(dst + 4*i), _mm_unpacklo_epi16(rg, ba));
+        _mm_storeu_si128((__m128i *)(dst + 4*i + 16), _mm_unpackhi_epi16(rg, ba));
+    }
+#endif
+    for (; i < count; i++)
+    {
+        unsigned short p = src[i];
+        unsigned char *q = dst + 4*i;
+
+        if (format == UNCOMPRESSED_R5G6B5)
+        {
+            q[0] = Expand5(p >> 11);
+            q[1] = Expand6((p >> 5) & 0x3f);
+            q[2] = Expand5(p & 0x1f);
+            q[3] = 255;
+        }
+        else if (format == UNCOMPRESSED_R5G5B5A1)
+        {
+            q[0] = Expand5(p >> 11);
+            q[1] = Expand5((p >> 6) & 0x1f);
+            q[2] = Expand5((p >> 1) & 0x1f);
+            q[3] = (p & 1)? 255 : 0;
+        }
+        else
+        {
+            q[0] = Expand4(p >> 12);
+            q[1] = Expand4((p >> 8) & 0x0f);
+            q[2] = Expand4((p >> 4) & 0x0f);
+            q[3] = Expand4(p & 0x0f);
+        }
+    }
+}
+
+// 8 bit channels to normalized float channels (v/255.0f)
+static void PixelsU8ToF32(const unsigned char *src, float *dst, int count)
+{
+    int i = 0;
+#if defined(IMAGE_FORMAT_AVX2)
+    const __m256 v255 = _mm256_set1_ps(255.0f);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256i v = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)(src + i)));
+        _mm256_storeu_ps(dst + i, _mm256_div_ps(_mm256_cvtepi32_ps(v), v255));
+    }
+#elif defined(IMAGE_FORMAT_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128 v255 = _mm_set1_ps(255.0f);
+
+    for (; i + 16 <= count; i += 16)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i lo = _mm_unpacklo_epi8(v, zero);
+        __m128i hi = _mm_unpackhi_epi8(v, zero);
+        _mm_storeu_ps(dst + i, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), v255));
+        _mm_storeu_ps(dst + i + 4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), v255));
+        _mm_storeu_ps(dst + i + 8, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), v255));
+        _mm_storeu_ps(dst + i + 12, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), v255));
+    }
+#endif
+    for (; i < count; i++) dst[i] = (float)src[i]/255.0f;
+}
+
+// Float channels to 8 bit channels (f*255.0f truncated, low byte kept)
+static void PixelsF32ToU8(const float *src, unsigned char *dst, int count)
+{
+    int i = 0;
+#if defined(IMAGE_FORMAT_AVX2)
+    const __m256 v255 = _mm256_set1_ps(255.0f);
+    const __m256i mask = _mm256_set1_epi32(0xff);
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+    for (; i + 32 <= count; i += 32)
+    {
+        __m256i a = _mm256_and_si256(_mm256_cvttps_epi32(_mm256_mul_ps(_mm256_loadu_ps(src + i), v255)), mask);
+        __m256i b = _mm256_and_si256(_mm256_cvttps_epi32(_mm256_mul_ps(_mm256_loadu_ps(src + i + 8), v255)), mask);
+        __m256i c = _mm256_and_si256(_mm256_cvttps_epi32(_mm256_mul_ps(_mm256_loadu_ps(src + i + 16), v255)), mask);
+        __m256i d = _mm256_and_si256(_mm256_cvttps_epi32(_mm256_mul_ps(_mm256_loadu_ps(src + i + 24), v255)), mask);
+
+        // Packing works per 128 bit lane: 4 bytes groups reordered afterwards
+        __m256i bytes = _mm256_packus_epi16(_mm256_packs_epi32(a, b), _mm256_packs_epi32(c, d));
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_permutevar8x32_epi32(bytes, order));
+    }
+#elif defined(IMAGE_FORMAT_SSE2)
+    const __m128 v255 = _mm_set1_ps(255.0f);
+    const __m128i mask = _mm_set1_epi32(0xff);
+
+    for (; i + 16 <= count; i += 16)
+    {
+        __m128i a = _mm_and_si128(_mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(src + i), v255)), mask);
+        __m128i b = _mm_and_si128(_mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(src + i + 4), v255)), mask);
+        __m128i c = _mm_and_si128(_mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(src + i + 8), v255)), mask);
+        __m128i d = _mm_and_si128(_mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(src + i + 12), v255)), mask);
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+    }
+#endif
+    for (; i < count; i++) dst[i] = (unsigned char)(int)(src[i]*255.0f);
+}
+
+// Convert image data using a fast path, returns false if conversion has none (generic path required)
+static bool ImageFormatFast(Image *image, int newFormat)
+{
+    int count = image->width*image->height;
+    int format = image->format;
+    const unsigned char *src = (const unsigned char *)image->data;
+    void *data = NULL;
+
+    if ((format == UNCOMPRESSED_R8G8B8) && (newFormat == UNCOMPRESSED_R8G8B8A8))
+    {
+        data = RL_MALLOC(count*4);
+        PixelsRGBToRGBA(src, (unsigned char *)data, count);
+    }
+    else if (format == UNCOMPRESSED_R8G8B8A8)
+    {
+        switch (newFormat)
+        {
+            case UNCOMPRESSED_R8G8B8: data = RL_MALLOC(count*3); PixelsRGBAToRGB(src, (unsigned char *)data, count); break;
+            case UNCOMPRESSED_GRAYSCALE: data = RL_MALLOC(count); PixelsRGBAToGray(src, (unsigned char *)data, count, false); break;
+            case UNCOMPRESSED_GRAY_ALPHA: data = RL_MALLOC(count*2); PixelsRGBAToGray(src, (unsigned char *)data, count, true); break;
+            case UNCOMPRESSED_R5G6B5:
+            case UNCOMPRESSED_R5G5B5A1:
+            case UNCOMPRESSED_R4G4B4A4: data = RL_MALLOC(count*sizeof(unsigned short)); PixelsRGBATo16(src, (unsigned short *)data, count, newFormat); break;
+            case UNCOMPRESSED_R32G32B32A32: data = RL_MALLOC(count*4*sizeof(float)); PixelsU8ToF32(src, (float *)data, count*4); break;
+            default: break;
+        }
+    }
+    else if (newFormat == UNCOMPRESSED_R8G8B8A8)
+    {
+        switch (format)
+        {
+            case UNCOMPRESSED_GRAYSCALE: data = RL_MALLOC(count*4); PixelsGrayToRGBA(src, (unsigned char *)data, count, false); break;
+            case UNCOMPRESSED_GRAY_ALPHA: data = RL_MALLOC(count*4); PixelsGrayToRGBA(src, (unsigned char *)data, count, true); break;
+            case UNCOMPRESSED_R5G6B5:
+            case UNCOMPRESSED_R5G5B5A1:
+            case UNCOMPRESSED_R4G4B4A4: data = RL_MALLOC(count*4); Pixels16ToRGBA((const unsigned short *)src, (unsigned char *)data, count, format); break;
+            case UNCOMPRESSED_R32G32B32A32: data = RL_MALLOC(count*4); PixelsF32ToU8((const float *)src, (unsigned char *)data, count*4); break;
+            default: break;
+        }
+    }
+    else if ((format == UNCOMPRESSED_R8G8B8) && (newFormat == UNCOMPRESSED_R32G32B32))
+    {
+        data = RL_MALLOC(count*3*sizeof(float));
+        PixelsU8ToF32(src, (float *)data, count*3);
+    }
+    else if ((format == UNCOMPRESSED_R32G32B32) && (newFormat == UNCOMPRESSED_R8G8B8))
+    {
+        data = RL_MALLOC(count*3);
+        PixelsF32ToU8((const float *)src, (unsigned char *)data, count*3);
+    }
+
+    if (data == NULL) return false;
+
+    RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
+    image->data = data;
+    image->format = newFormat;
+
+    // In case original image had mipmaps, generate mipmaps for formated image (as generic path)
+    if (image->mipmaps > 1)
+    {
+        image->mipmaps = 1;
+    #if defined(SUPPORT_IMAGE_MANIPULATION)
+        ImageMipmaps(image);
+    #endif
+    }
+
+    return true;
+}
+#endif      // SUPPORT_IMAGE_FORMAT_FAST
+
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// Resize 8 bit per channel pixels data, using stb default bicubic filters
+// NOTE: Big images are split in output rows strips resized in parallel, every strip
+// samples the full input image, so result does not depend on threads count
+static void ResizePixels(const unsigned char *input, int width, int height, unsigned char *output, int newWidth, int newHeight, int channels)
+{
+#if defined(SUPPORT_IMAGE_PARALLEL)
+    int threadCount = (imageThreads > 0)? imageThreads : GetCPUCount();
+    int stripsCount = newHeight/IMAGE_PARALLEL_STRIP_ROWS;
+
+    if (stripsCount > threadCount*IMAGE_PARALLEL_STRIPS_PER_THREAD) stripsCount = threadCount*IMAGE_PARALLEL_STRIPS_PER_THREAD;
+
+    if ((threadCount > 1) && (stripsCount > 1) && (newWidth*newHeight >= MAX_IMAGE_PARALLEL_MIN_PIXELS))
+    {
+        ImageResizeJob *jobs = (ImageResizeJob *)RL_MALLOC(stripsCount*sizeof(ImageResizeJob));
+
+        for (int i = 0, firstRow = 0; i < stripsCount; i++)
+        {
+            int rowsCount = newHeight/stripsCount + ((i < (newHeight%stripsCount))? 1 : 0);
+
+            jobs[i] = (ImageResizeJob){ input, width, height, output, newWidth, newHeight, channels, firstRow, rowsCount };
+            firstRow += rowsCount;
+        }
+
+        RunJobsParallel(ResizePixelsStrip, jobs, sizeof(ImageResizeJob), stripsCount, threadCount);
+
+        RL_FREE(jobs);
+        return;
+    }
+#endif
+
+    stbir_resize_uint8(input, width, height, 0, output, newWidth, newHeight, 0, channels);
+}
+
+// Resize job: compute one rows strip of output image
+// NOTE: Same scale as full image resize, vertical offset moves output window to strip first row
+static void ResizePixelsStrip(void *data)
+{
+    ImageResizeJob *job = (ImageResizeJob *)data;
+
+    stbir_resize_subpixel(job->input, job->width, job->height, 0,
+        job->output + (size_t)job->firstRow*job->newWidth*job->channels, job->newWidth, job->rowsCount, 0,
+        STBIR_TYPE_UINT8, job->channels, STBIR_ALPHA_CHANNEL_NONE, 0, STBIR_EDGE_CLAMP, STBIR_EDGE_CLAMP,
+        STBIR_FILTER_DEFAULT, STBIR_FILTER_DEFAULT, STBIR_COLORSPACE_LINEAR, NULL,
+        (float)job->newWidth/job->width, (float)job->newHeight/job->height, 0.0f, (float)job->firstRow);
+}
+#endif
+
+#if defined(SUPPORT_IMAGE_COMPRESSION)
+// DXT color palette from RGB565 endpoints, four colors mode (interpolated) or three colors mode (transparent black)
+static void GetDXTColorPalette(unsigned short c0, unsigned short c1, bool fourColors, int palette[4][3])
+{
+    unsigned short endpoints[2] = { c0, c1 };
+
+    for (int i = 0; i < 2; i++)
+    {
+        int r = (endpoints[i] >> 11) & 0x1f;
+        int g = (endpoints[i] >> 5) & 0x3f;
+        int b = endpoints[i] & 0x1f;
+
+        palette[i][0] = (r << 3) | (r >> 2);
+        palette[i][1] = (g << 2) | (g >> 4);
+        palette[i][2] = (b << 3) | (b >> 2);
+    }
+
+    for (int k = 0; k < 3; k++)
+    {
+        if (fourColors)
+        {
+            palette[2][k] = (2*palette[0][k] + palette[1][k] + 1)/3;
+            palette[3][k] = (palette[0][k] + 2*palette[1][k] + 1)/3;
+        }
+        else
+        {
+            palette[2][k] = (palette[0][k] + palette[1][k] + 1)/2;
+            palette[3][k] = 0;
+        }
+    }
+}
+
+// DXT alpha palette from endpoints, eight values mode (a0 > a1) or six values mode (a0 <= a1, with 0 and 255)
+static void GetDXTAlphaPalette(int a0, int a1, int palette[8])
+{
+    palette[0] = a0;
+    palette[1] = a1;
+
+    if (a0 > a1) for (int i = 2; i < 8; i++) palette[i] = ((8 - i)*a0 + (i - 1)*a1 + 3)/7;
+    else
+    {
+        for (int i = 2; i < 6; i++) palette[i] = ((6 - i)*a0 + (i - 1)*a1 + 2)/5;
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+}
+
+// Select nearest palette color for every block pixel (RGB squared distance), returns block error
+// NOTE: Distances are exact in float (integer values < 2^24), SIMD and scalar paths select the same indices
+static int SelectDXTColorIndices(const float pixels[3][16], const int palette[4][3], int paletteCount, int indices[16])
+{
+    int error = 0;
+
+#if defined(IMAGE_FORMAT_SSE2)
+    for (int i = 0; i < 16; i += 4)
+    {
+        __m128 r = _mm_loadu_ps(pixels[0] + i);
+        __m128 g = _mm_loadu_ps(pixels[1] + i);
+        __m128 b = _mm_loadu_ps(pixels[2] + i);
+        __m128 bestError = _mm_set1_ps(1e30f);
+        __m128i bestIndex = _mm_setzero_si128();
+
+        for (int p = 0; p < paletteCount; p++)
+        {
+            __m128 dr = _mm_sub_ps(r, _mm_set1_ps((float)palette[p][0]));
+            __m128 dg = _mm_sub_ps(g, _mm_set1_ps((float)palette[p][1]));
+            __m128 db = _mm_sub_ps(b, _mm_set1_ps((float)palette[p][2]));
+            __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dr, dr), _mm_mul_ps(dg, dg)), _mm_mul_ps(db, db));
+            __m128i closer = _mm_castps_si128(_mm_cmplt_ps(distance, bestError));
+
+            bestError = _mm_min_ps(distance, bestError);
+            bestIndex = _mm_or_si128(_mm_andnot_si128(closer, bestIndex), _mm_and_si128(closer, _mm_set1_epi32(p)));
+        }
+
+        float errors[4];
+        _mm_storeu_ps(errors, bestError);
+        _mm_storeu_si128((__m128i *)(indices + i), bestIndex);
+        error += (int)errors[0] + (int)errors[1] + (int)errors[2] + (int)errors[3];
+    }
+#else
+    for (int i = 0; i < 16; i++)
+    {
+        int bestError = 0x7fffffff;
+
+        for (int p = 0; p < paletteCount; p++)
+        {
+            int dr = (int)pixels[0][i] - palette[p][0];
+            int dg = (int)pixels[1][i] - palette[p][1];
+            int db = (int)pixels[2][i] - palette[p][2];
+            int distance = dr*dr + dg*dg + db*db;
+
+            if (distance < bestError)
+            {
+                bestError = distance;
+                indices[i] = p;
+            }
+        }
+
+        error += bestError;
+    }
+#endif
+
+    return error;
+}
+
+// Quantize RGB color to RGB565
+static unsigned short GetDXTColor565(const float color[3])
+{
+    int r = (int)(fminf(fmaxf(color[0], 0.0f), 255.0f)*31.0f/255.0f + 0.5f);
+    int g = (int)(fminf(fmaxf(color[1], 0.0f), 255.0f)*63.0f/255.0f + 0.5f);
+    int b = (int)(fminf(fmaxf(color[2], 0.0f), 255.0f)*31.0f/255.0f + 0.5f);
+
+    return (unsigned short)((r << 11) | (g << 5) | b);
+}
+
+// Evaluate color endpoints: palette indices of opaque pixels and error
+// NOTE: Endpoints are ordered for desired mode: c0 > c1 in four colors mode, c0 <= c1 in three colors mode
+static int EvaluateDXTColorEndpoints(const float pixels[3][16], const bool *transparent, bool fourColors, unsigned short *c0, unsigned short *c1, int indices[16])
+{
+    if ((fourColors && (*c0 < *c1)) || (!fourColors && (*c0 > *c1)))
+    {
+        unsigned short temp = *c0;
+        *c0 = *c1;
+        *c1 = temp;
+    }
+
+    int palette[4][3] = { 0 };
+    GetDXTColorPalette(*c0, *c1, fourColors, palette);
+
+    // NOTE: Single color block, decoded in three colors mode if endpoints are equal: only first color can be used
+    int error = SelectDXTColorIndices(pixels, palette, (*c0 == *c1)? 1 : (fourColors? 4 : 3), indices);
+
+    if (transparent != NULL) for (int i = 0; i < 16; i++) if (transparent[i]) indices[i] = 3;
+
+    return error;
+}
+
+// Refine color endpoints from current indices (least squares fit of pixels on palette line)
+// Returns false if endpoints can not be refined (single index used)
+static bool RefineDXTColorEndpoints(const float pixels[3][16], const bool *transparent, bool fourColors, const int indices[16], unsigned short *c0, unsigned short *c1)
+{
+    const float weights4[4] = { 1.0f, 0.0f, 2.0f/3.0f, 1.0f/3.0f };
+    const float weights3[4] = { 1.0f, 0.0f, 0.5f, 0.0f };
+    const float *weights = fourColors? weights4 : weights3;
+
+    float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+    float ax[3] = { 0 }, bx[3] = { 0 };
+
+    for (int i = 0; i < 16; i++)
+    {
+        if ((transparent != NULL) && transparent[i]) continue;
+
+        float a = weights[indices[i]];
+        float b = 1.0f - a;
+
+        aa += a*a;
+        ab += a*b;
+        bb += b*b;
+
+        for (int k = 0; k < 3; k++)
+        {
+            ax[k] += a*pixels[k][i];
+            bx[k] += b*pixels[k][i];
+        }
+    }
+
+    float det = aa*bb - ab*ab;
+    if (fabsf(det) < 1e-6f) return false;
+
+    float color0[3], color1[3];
+
+    for (int k = 0; k < 3; k++)
+    {
+        color0[k] = (ax[k]*bb - bx[k]*ab)/det;
+        color1[k] = (bx[k]*aa - ax[k]*ab)/det;
+    }
+
+    *c0 = GetDXTColor565(color0);
+    *c1 = GetDXTColor565(color1);
+
+    return true;
+}
+
+// Compress 4x4 RGBA block color into DXT1 color block (8 bytes)
+// NOTE: Transparent pixels are only encoded if allowed (DXT1 with 1 bit alpha), using three colors mode
+static void CompressDXTColorBlock(const unsigned char *block, unsigned char *output, bool allowTransparent, int quality)
+{
+    float pixels[3][16];
+    bool transparent[16] = { 0 };
+    bool anyTransparent = false;
+    float mean[3] = { 0 };
+    float minColor[3] = { 255.0f, 255.0f, 255.0f };
+    float maxColor[3] = { 0 };
+    int opaqueCount = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        for (int k = 0; k < 3; k++) pixels[k][i] = (float)block[i*4 + k];
+
+        if (allowTransparent && (block[i*4 + 3] < UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD))
+        {
+            transparent[i] = true;
+            anyTransparent = true;
+            continue;
+        }
+
+        for (int k = 0; k < 3; k++)
+        {
+            mean[k] += pixels[k][i];
+            if (pixels[k][i] < minColor[k]) minColor[k] = pixels[k][i];
+            if (pixels[k][i] > maxColor[k]) maxColor[k] = pixels[k][i];
+        }
+
+        opaqueCount++;
+    }
+
+    unsigned short c0 = 0, c1 = 0;
+    int indices[16] = { 0 };
+    bool fourColors = !anyTransparent;
+
+    if (opaqueCount == 0)
+    {
+        // Fully transparent block
+        c0 = 0;
+        c1 = 0;
+        for (int i = 0; i < 16; i++) indices[i] = 3;
+    }
+    else
+    {
+        for (int k = 0; k < 3; k++) mean[k] /= opaqueCount;
+
+        // Covariance of opaque pixels colors
+        float covariance[6] = { 0 };    // rr, rg, rb, gg, gb, bb
+
+        for (int i = 0; i < 16; i++)
+        {
+            if (transparent[i]) continue;
+
+            float r = pixels[0][i] - mean[0];
+            float g = pixels[1][i] - mean[1];
+            float b = pixels[2][i] - mean[2];
+
+            covariance[0] += r*r;
+            covariance[1] += r*g;
+            covariance[2] += r*b;
+            covariance[3] += g*g;
+            covariance[4] += g*b;
+            covariance[5] += b*b;
+        }
+
+        float color0[3], color1[3];
+
+        if (quality == COMPRESSION_FAST)
+        {
+            // Bounding box diagonal following colors correlation, inset by 1/16 of its size
+            for (int k = 0; k < 3; k++)
+            {
+                float inset = (maxColor[k] - minColor[k])/16.0f;
+                color0[k] = maxColor[k] - inset;
+                color1[k] = minColor[k] + inset;
+            }
+
+            if (covariance[1] < 0.0f) { float temp = color0[1]; color0[1] = color1[1]; color1[1] = temp; }
+            if (covariance[2] < 0.0f) { float temp = color0[2]; color0[2] = color1[2]; color1[2] = temp; }
+        }
+        else
+        {
+            // Principal axis (power iteration), endpoints at extreme pixels projections
+            float axis[3] = { maxColor[0] - minColor[0], maxColor[1] - minColor[1], maxColor[2] - minColor[2] };
+
+            if (covariance[1] < 0.0f) axis[1] = -axis[1];
+            if (covariance[2] < 0.0f) axis[2] = -axis[2];
+
+            for (int iteration = 0; iteration < 8; iteration++)
+            {
+                float x = axis[0]*covariance[0] + axis[1]*covariance[1] + axis[2]*covariance[2];
+                float y = axis[0]*covariance[1] + axis[1]*covariance[3] + axis[2]*covariance[4];
+                float z = axis[0]*covariance[2] + axis[1]*covariance[4] + axis[2]*covariance[5];
+                float length = fmaxf(fabsf(x), fmaxf(fabsf(y), fabsf(z)));
+
+                if (length < 1e-6f) break;
+
+                axis[0] = x/length;
+                axis[1] = y/length;
+                axis[2] = z/length;
+            }
+
+            float axisLength = axis[0]*axis[0] + axis[1]*axis[1] + axis[2]*axis[2];
+            float minProjection = 0.0f, maxProjection = 0.0f;
+
+            for (int i = 0; (i < 16) && (axisLength > 1e-6f); i++)
+            {
+                if (transparent[i]) continue;
+
+                float projection = ((pixels[0][i] - mean[0])*axis[0] + (pixels[1][i] - mean[1])*axis[1] + (pixels[2][i] - mean[2])*axis[2])/axisLength;
+
+                if (projection < minProjection) minProjection = projection;
+                if (projection > maxProjection) maxProjection = projection;
+            }
+
+            for (int k = 0; k < 3; k++)
+            {
+                color0[k] = mean[k] + maxProjection*axis[k];
+                color1[k] = mean[k] + minProjection*axis[k];
+            }
+        }
+
+        c0 = GetDXTColor565(color0);
+        c1 = GetDXTColor565(color1);
+
+        const bool *mask = anyTransparent? transparent : NULL;
+        int error = EvaluateDXTColorEndpoints(pixels, mask, fourColors, &c0, &c1, indices);
+
+        // Least squares refinement, kept while error decreases
+        int refinements = (quality == COMPRESSION_HIGH)? 4 : ((quality == COMPRESSION_NORMAL)? 1 : 0);
+
+        for (int r = 0; (r < refinements) && (error > 0); r++)
+        {
+            unsigned short refined0 = c0, refined1 = c1;
+            int refinedIndices[16];
+
+            if (!RefineDXTColorEndpoints(pixels, mask, fourColors, indices, &refined0, &refined1)) break;
+
+            int refinedError = EvaluateDXTColorEndpoints(pixels, mask, fourColors, &refined0, &refined1, refinedIndices);
+
+            if (refinedError >= error) break;
+
+            error = refinedError;
+            c0 = refined0;
+            c1 = refined1;
+            memcpy(indices, refinedIndices, sizeof(indices));
+        }
+    }
+
+    unsigned int bits = 0;
+    for (int i = 0; i < 16; i++) bits |= (unsigned int)indices[i] << (2*i);
+
+    output[0] = (unsigned char)(c0 & 0xff);
+    output[1] = (unsigned char)(c0 >> 8);
+    output[2] = (unsigned char)(c1 & 0xff);
+    output[3] = (unsigned char)(c1 >> 8);
+    output[4] = (unsigned char)(bits & 0xff);
+    output[5] = (unsigned char)((bits >> 8) & 0xff);
+    output[6] = (unsigned char)((bits >> 16) & 0xff);
+    output[7] = (unsigned char)(bits >> 24);
+}
+
+// Select nearest alpha palette values, returns block error
+static int SelectDXTAlphaIndices(const unsigned char *block, const int palette[8], int indices[16])
+{
+    int error = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        int bestError = 0x7fffffff;
+
+        for (int p = 0; p < 8; p++)
+        {
+            int distance = ((int)block[i*4 + 3] - palette[p])*((int)block[i*4 + 3] - palette[p]);
+
+            if (distance < bestError)
+            {
+                bestError = distance;
+                indices[i] = p;
+            }
+        }
+
+        error += bestError;
+    }
+
+    return error;
+}
+
+// Compress 4x4 RGBA block alpha into DXT5 alpha block (8 bytes)
+// NOTE: High quality also tries six values mode (explicit 0 and 255), better for blocks with sharp transparency
+static void CompressDXTAlphaBlock(const unsigned char *block, unsigned char *output, int quality)
+{
+    int minAlpha = 255, maxAlpha = 0;
+    int minInner = 255, maxInner = 0;       // Alpha range without 0 and 255 values
+
+    for (int i = 0; i < 16; i++)
+    {
+        int alpha = block[i*4 + 3];
+
+        if (alpha < minAlpha) minAlpha = alpha;
+        if (alpha > maxAlpha) maxAlpha = alpha;
+
+        if ((alpha > 0) && (alpha < 255))
+        {
+            if (alpha < minInner) minInner = alpha;
+            if (alpha > maxInner) maxInner = alpha;
+        }
+    }
+
+    int a0 = maxAlpha, a1 = minAlpha;
+    int palette[8];
+    int indices[16];
+
+    GetDXTAlphaPalette(a0, a1, palette);
+    int error = SelectDXTAlphaIndices(block, palette, indices);
+
+    if ((quality == COMPRESSION_HIGH) && (error > 0))
+    {
+        int inner0 = (minInner <= maxInner)? minInner : 0;
+        int inner1 = (minInner <= maxInner)? maxInner : 0;
+        int innerIndices[16];
+
+        GetDXTAlphaPalette(inner0, inner1, palette);
+
+        if (SelectDXTAlphaIndices(block, palette, innerIndices) < error)
+        {
+            a0 = inner0;
+            a1 = inner1;
+            memcpy(indices, innerIndices, sizeof(indices));
+        }
+    }
+
+    output[0] = (unsigned char)a0;
+    output[1] = (unsigned char)a1;
+
+    // 16 indices of 3 bits (48 bits, little endian)
+    for (int half = 0; half < 2; half++)
+    {
+        unsigned int bits = 0;
+        for (int i = 0; i < 8; i++) bits |= (unsigned int)indices[half*8 + i] << (3*i);
+
+        output[2 + half*3] = (unsigned char)(bits & 0xff);
+        output[3 + half*3] = (unsigned char)((bits >> 8) & 0xff);
+        output[4 + half*3] = (unsigned char)((bits >> 16) & 0xff);
+    }
+}
+
+// Compress 4x4 RGBA block into DXT block (8 or 16 bytes)
+static void CompressDXTBlock(const unsigned char *block, unsigned char *output, int format, int quality)
+{
+    switch (format)
+    {
+        case COMPRESSED_DXT1_RGB: CompressDXTColorBlock(block, output, false, quality); break;
+        case COMPRESSED_DXT1_RGBA: CompressDXTColorBlock(block, output, true, quality); break;
+        case COMPRESSED_DXT3_RGBA:
+        {
+            // Explicit 4 bit alpha
+            for (int i = 0; i < 8; i++) output[i] = (unsigned char)(((block[i*8 + 3]*15 + 127)/255) | (((block[i*8 + 7]*15 + 127)/255) << 4));
+            CompressDXTColorBlock(block, output + 8, false, quality);
+        } break;
+        case COMPRESSED_DXT5_RGBA:
+        {
+            CompressDXTAlphaBlock(block, output, quality);
+            CompressDXTColorBlock(block, output + 8, false, quality);
+        } break;
+        default: break;
+    }
+}
+
+// Decompress DXT block (8 or 16 bytes) into 4x4 RGBA block
+static void DecompressDXTBlock(const unsigned char *input, unsigned char *block, int format)
+{
+    const unsigned char *color = ((format == COMPRESSED_DXT3_RGBA) || (format == COMPRESSED_DXT5_RGBA))? input + 8 : input;
+    unsigned short c0 = (unsigned short)(color[0] | (color[1] << 8));
+    unsigned short c1 = (unsigned short)(color[2] | (color[3] << 8));
+    unsigned int bits = color[4] | (color[5] << 8) | (color[6] << 16) | ((unsigned int)color[7] << 24);
+
+    // NOTE: DXT3 and DXT5 color blocks always use four colors mode
+    bool fourColors = (c0 > c1) || (format == COMPRESSED_DXT3_RGBA) || (format == COMPRESSED_DXT5_RGBA);
+    int palette[4][3];
+
+    GetDXTColorPalette(c0, c1, fourColors, palette);
+
+    for (int i = 0; i < 16; i++)
+    {
+        int index = (bits >> (2*i)) & 0x3;
+
+        block[i*4] = (unsigned char)palette[index][0];
+        block[i*4 + 1] = (unsigned char)palette[index][1];
+        block[i*4 + 2] = (unsigned char)palette[index][2];
+        block[i*4 + 3] = (!fourColors && (index == 3))? 0 : 255;
+    }
+
+    if (format == COMPRESSED_DXT3_RGBA)
+    {
+        for (int i = 0; i < 16; i++) block[i*4 + 3] = (unsigned char)(((input[i/2] >> (4*(i%2))) & 0xf)*17);
+    }
+    else if (format == COMPRESSED_DXT5_RGBA)
+    {
+        int alphaPalette[8];
+        GetDXTAlphaPalette(input[0], input[1], alphaPalette);
+
+        for (int half = 0; half < 2; half++)
+        {
+            unsigned int alphaBits = input[2 + half*3] | (input[3 + half*3] << 8) | (input[4 + half*3] << 16);
+            for (int i = 0; i < 8; i++) block[(half*8 + i)*4 + 3] = (unsigned char)alphaPalette[(alphaBits >> (3*i)) & 0x7];
+        }
+    }
+}
+
+// Image compression job: rows of 4x4 blocks, compressed or decompressed
+static void ProcessDXTBlockRows(void *data)
+{
+    ImageCompressionJob *job = (ImageCompressionJob *)data;
+    int blocksX = (job->width + 3)/4;
+    int blockSize = (job->format < COMPRESSED_DXT3_RGBA)? 8 : 16;
+    unsigned char block[64];
+
+    for (int by = job->firstRow; by < job->firstRow + job->rowsCount; by++)
+    {
+        for (int bx = 0; bx < blocksX; bx++)
+        {
+            unsigned char *blockData = job->blocks + ((size_t)by*blocksX + bx)*blockSize;
+
+            if (job->decompress)
+            {
+                DecompressDXTBlock(blockData, block, job->format);
+
+                for (int y = 0; y < 4; y++)
+                {
+                    for (int x = 0; x < 4; x++)
+                    {
+                        int px = bx*4 + x, py = by*4 + y;
+                        if ((px < job->width) && (py < job->height)) memcpy(job->pixels + ((size_t)py*job->width + px)*4, block + (y*4 + x)*4, 4);
+                    }
+                }
+            }
+            else
+            {
+                // NOTE: Partial blocks on right and bottom edges are filled replicating edge pixels
+                for (int y = 0; y < 4; y++)
+                {
+                    for (int x = 0; x < 4; x++)
+                    {
+                        int px = (bx*4 + x < job->width)? bx*4 + x : job->width - 1;
+                        int py = (by*4 + y < job->height)? by*4 + y : job->height - 1;
+                        memcpy(block + (y*4 + x)*4, job->pixels + ((size_t)py*job->width + px)*4, 4);
+                    }
+                }
+
+                CompressDXTBlock(block, blockData, job->format, job->quality);
+            }
+        }
+    }
+}
+
+// Compress or decompress one image level, blocks rows split between threads
+static void ProcessDXTLevel(unsigned char *pixels, unsigned char *blocks, int width, int height, int format, bool decompress)
+{
+    int rowsCount = (height + 3)/4;
+    int threadCount = (imageThreads > 0)? imageThreads : GetCPUCount();
+    int jobsCount = 1;
+
+#if defined(SUPPORT_IMAGE_PARALLEL)
+    if ((threadCount > 1) && (width*height >= MAX_IMAGE_PARALLEL_MIN_PIXELS)) jobsCount = (rowsCount < threadCount*IMAGE_PARALLEL_STRIPS_PER_THREAD)? rowsCount : threadCount*IMAGE_PARALLEL_STRIPS_PER_THREAD;
+#endif
+
+    ImageCompressionJob *jobs = (ImageCompressionJob *)RL_MALLOC(jobsCount*sizeof(ImageCompressionJob));
+
+    for (int i = 0, firstRow = 0; i < jobsCount; i++)
+    {
+        int count = rowsCount/jobsCount + ((i < (rowsCount%jobsCount))? 1 : 0);
+
+        jobs[i] = (ImageCompressionJob){ pixels, blocks, width, height, format, imageCompressionQuality, decompress, firstRow, count };
+        firstRow += count;
+    }
+
+    RunJobsParallel(ProcessDXTBlockRows, jobs, sizeof(ImageCompressionJob), jobsCount, threadCount);
+
+    RL_FREE(jobs);
+}
+
+// Convert image data from/to DXT compressed formats (all mipmap levels)
+// NOTE: Uncompressed data is converted through 32bit RGBA, returns false if conversion is not supported
+static bool ImageFormatCompressed(Image *image, int newFormat)
+{
+    bool compress = (newFormat >= COMPRESSED_DXT1_RGB) && (newFormat <= COMPRESSED_DXT5_RGBA) && (image->format < COMPRESSED_DXT1_RGB);
+    bool decompress = (image->format >= COMPRESSED_DXT1_RGB) && (image->format <= COMPRESSED_DXT5_RGBA);
+
+    if (!compress && !decompress) return false;
+
+    if (compress && (image->format != UNCOMPRESSED_R8G8B8A8)) ImageFormat(image, UNCOMPRESSED_R8G8B8A8);
+
+    int format = compress? newFormat : image->format;
+    int sourceFormat = image->format;
+    int targetFormat = compress? newFormat : UNCOMPRESSED_R8G8B8A8;
+    int dataSize = 0;
+
+    for (int i = 0, width = image->width, height = image->height; i < image->mipmaps; i++, width = (width > 1)? width/2 : 1, height = (height > 1)? height/2 : 1)
+    {
+        dataSize += GetPixelDataSize(width, height, targetFormat);
+    }
+
+    unsigned char *data = (unsigned char *)RL_MALLOC(dataSize);
+    unsigned char *source = (unsigned char *)image->data;
+    unsigned char *target = data;
+
+    for (int i = 0, width = image->width, height = image->height; i < image->mipmaps; i++, width = (width > 1)? width/2 : 1, height = (height > 1)? height/2 : 1)
+    {
+        if (compress) ProcessDXTLevel(source, target, width, height, format, false);
+        else ProcessDXTLevel(target, source, width, height, format, true);
+
+        source += GetPixelDataSize(width, height, sourceFormat);
+        target += GetPixelDataSize(width, height, targetFormat);
+    }
+
+    RL_FREE(image->data);
+    image->data = data;
+    image->format = targetFormat;
+
+    // Decompressed to 32bit RGBA, converted to requested format
+    if (decompress && (newFormat != UNCOMPRESSED_R8G8B8A8)) ImageFormat(image, newFormat);
+
+    return true;
+}
+#endif      // SUPPORT_IMAGE_COMPRESSION
+
+// Get color as destination format pixel bytes, returns bytes per pixel (0 for compressed formats)
+// NOTE: Same conversion as ImageDrawPixel(), computed once for every drawn pixel
+static int GetPixelPacked(Color color, int format, unsigned char *pixel)
+{
+    if (format >= COMPRESSED_DXT1_RGB) return 0;
+
+    Image packed = { pixel, 1, 1, 1, format };
+    ImageDrawPixel(&packed, 0, 0, color);
+
+    return GetPixelDataSize(1, 1, format);
+}
+
+// Fill image row span with packed pixel, clipped to image bounds
+// NOTE: Span is filled by doubling copies of first pixel
+static void ImageFillSpan(Image *dst, int x, int y, int count, const unsigned char *pixel, int bytesPerPixel)
+{
+    if ((y < 0) || (y >= dst->height)) return;
+
+    if (x < 0) { count += x; x = 0; }
+    if ((x + count) > dst->width) count = dst->width - x;
+    if (count <= 0) return;
+
+    unsigned char *span = (unsigned char *)dst->data + ((size_t)y*dst->width + x)*bytesPerPixel;
+    int size = count*bytesPerPixel;
+
+    if (bytesPerPixel == 1) memset(span, pixel[0], count);
+    else
+    {
+        memcpy(span, pixel, bytesPerPixel);
+
+        for (int filled = bytesPerPixel; filled < size; filled *= 2) memcpy(span + filled, span, ((size - filled) < filled)? size - filled : filled);
+    }
+}
+
+// Alpha blend tinted 32bit RGBA source pixels over destination pixels row
+// NOTE: Bit-exact with ColorAlphaBlend(), including its integer division by blended alpha
+static void BlendPixelsRGBA(unsigned char *dst, const unsigned char *src, int count, Color tint)
+{
+    int i = 0;
+
+#if defined(IMAGE_FORMAT_SSE2)
+    const __m128i mask = _mm_set1_epi32(0xff);
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i full = _mm_set1_epi32(256);
+    const __m128i tintR = _mm_set1_epi32(tint.r), tintG = _mm_set1_epi32(tint.g), tintB = _mm_set1_epi32(tint.b), tintA = _mm_set1_epi32(tint.a);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i s = _mm_loadu_si128((const __m128i *)(src + i*4));
+        __m128i d = _mm_loadu_si128((const __m128i *)(dst + i*4));
+
+        // NOTE: Channels in 32 bit lanes, 16 bit multiplies are exact for products under 65536
+        __m128i sr = _mm_srli_epi32(_mm_mullo_epi16(_mm_and_si128(s, mask), tintR), 8);
+        __m128i sg = _mm_srli_epi32(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi32(s, 8), mask), tintG), 8);
+        __m128i sb = _mm_srli_epi32(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi32(s, 16), mask), tintB), 8);
+        __m128i sa = _mm_srli_epi32(_mm_mullo_epi16(_mm_srli_epi32(s, 24), tintA), 8);
+
+        __m128i transparent = _mm_cmpeq_epi32(sa, _mm_setzero_si128());
+        __m128i opaque = _mm_cmpeq_epi32(sa, mask);
+
+        // Skip fully transparent pixels
+        if (_mm_movemask_epi8(transparent) == 0xffff) continue;
+
+        __m128i da = _mm_srli_epi32(d, 24);
+        __m128i alpha = _mm_add_epi32(sa, one);
+        __m128i inverse = _mm_sub_epi32(full, alpha);
+
+        // out.a = (alpha*256 + dst.a*(256 - alpha)) >> 8
+        __m128i outA = _mm_srli_epi32(_mm_add_epi32(_mm_slli_epi32(alpha, 8), _mm_mullo_epi16(da, inverse)), 8);
+        __m128i divisor = _mm_slli_epi32(outA, 8);
+        __m128 reciprocal = _mm_div_ps(_mm_set1_ps(1.0f), _mm_cvtepi32_ps(divisor));
+
+        __m128i channels[3] = { sr, sg, sb };
+        __m128i result = _mm_slli_epi32(_mm_and_si128(outA, mask), 24);
+
+        for (int c = 0; c < 3; c++)
+        {
+            __m128i dc = _mm_and_si128(_mm_srli_epi32(d, 8*c), mask);
+            __m128i weight = _mm_mullo_epi16(dc, da);
+
+            // n = src.c*alpha*256 + dst.c*dst.a*(256 - alpha), 32 bit product from 16 bit halves
+            __m128i product = _mm_add_epi32(_mm_mullo_epi16(weight, inverse), _mm_slli_epi32(_mm_mulhi_epu16(weight, inverse), 16));
+            __m128i n = _mm_add_epi32(_mm_slli_epi32(_mm_mullo_epi16(channels[c], alpha), 8), product);
+
+            // q = (n/out.a) >> 8 = n/(out.a*256), float estimate corrected to exact integer quotient
+            __m128i q = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(n), reciprocal));
+            __m128i remainder = _mm_sub_epi32(n, _mm_slli_epi32(_mm_mullo_epi16(q, outA), 8));
+
+            q = _mm_add_epi32(q, _mm_srai_epi32(remainder, 31));     // remainder < 0: q - 1
+            q = _mm_sub_epi32(q, _mm_xor_si128(_mm_cmplt_epi32(remainder, divisor), _mm_set1_epi32(-1)));  // remainder >= divisor: q + 1
+
+            result = _mm_or_si128(result, _mm_slli_epi32(_mm_and_si128(q, mask), 8*c));
+        }
+
+        __m128i tinted = _mm_or_si128(_mm_or_si128(sr, _mm_slli_epi32(sg, 8)), _mm_or_si128(_mm_slli_epi32(sb, 16), _mm_slli_epi32(sa, 24)));
+
+        result = _mm_or_si128(_mm_and_si128(opaque, tinted), _mm_andnot_si128(opaque, result));
+        result = _mm_or_si128(_mm_and_si128(transparent, d), _mm_andnot_si128(transparent, result));
+
+        _mm_storeu_si128((__m128i *)(dst + i*4), result);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        Color blend = ColorAlphaBlend(*(Color *)(dst + i*4), *(Color *)(src + i*4), tint);
+        memcpy(dst + i*4, &blend, 4);
+    }
+}
+
+#if defined(SUPPORT_IMAGE_GENERATION)
+// Run image generation job on image rows, split in rows strips processed by multiple threads
+static void GenImageRows(JobFunc func, ImageGenerationJob job)
+{
+    int stripsCount = 1;
+    int threadCount = 1;
+
+#if defined(SUPPORT_IMAGE_PARALLEL)
+    threadCount = (imageThreads > 0)? imageThreads : GetCPUCount();
+
+    if ((threadCount > 1) && (job.width*job.height >= MAX_IMAGE_PARALLEL_MIN_PIXELS))
+    {
+        stripsCount = job.height/IMAGE_PARALLEL_STRIP_ROWS;
+        if (stripsCount > threadCount*IMAGE_PARALLEL_STRIPS_PER_THREAD) stripsCount = threadCount*IMAGE_PARALLEL_STRIPS_PER_THREAD;
+        if (stripsCount < 1) stripsCount = 1;
+    }
+#endif
+
+    ImageGenerationJob *jobs = (ImageGenerationJob *)RL_MALLOC(stripsCount*sizeof(ImageGenerationJob));
+
+    for (int i = 0, firstRow = 0; i < stripsCount; i++)
+    {
+        jobs[i] = job;
+        jobs[i].firstRow = firstRow;
+        jobs[i].rowsCount = job.height/stripsCount + ((i < (job.height%stripsCount))? 1 : 0);
+        firstRow += jobs[i].rowsCount;
+    }
+
+    RunJobsParallel(func, jobs, sizeof(ImageGenerationJob), stripsCount, threadCount);
+
+    RL_FREE(jobs);
+}
+
+// Perlin fbm noise for 4 points with same y coordinate (z = 1, lacunarity = 2, gain = 0.5, 6 octaves)
+// NOTE: Same operations as stb_perlin_fbm_noise3(), results are bit-exact; hash tables lookups are scalar
+static void PerlinNoiseFbm4(const float *x, float y, PerlinNoiseCache *cache, float *noise)
+{
+#if defined(IMAGE_FORMAT_SSE2)
+    // Gradients basis used by stb_perlin
+    static const float gradients[12][3] = {
+        { 1, 1, 0 }, { -1, 1, 0 }, { 1, -1, 0 }, { -1, -1, 0 },
+        { 1, 0, 1 }, { -1, 0, 1 }, { 1, 0, -1 }, { -1, 0, -1 },
+        { 0, 1, 1 }, { 0, -1, 1 }, { 0, 1, -1 }, { 0, -1, -1 }
+    };
+
+    const __m128 one = _mm_set1_ps(1.0f);
+    __m128 sum = _mm_setzero_ps();
+    float frequency = 1.0f;
+    float amplitude = 1.0f;
+
+    for (int octave = 0; octave < 6; octave++)
+    {
+        __m128 fx = _mm_mul_ps(_mm_loadu_ps(x), _mm_set1_ps(frequency));
+        float fy = y*frequency;
+        float fz = 1.0f*frequency;
+
+        // Lattice cell (floor) and position inside cell
+        __m128i px = _mm_cvttps_epi32(fx);
+        px = _mm_add_epi32(px, _mm_castps_si128(_mm_cmplt_ps(fx, _mm_cvtepi32_ps(px))));
+        int py = stb__perlin_fastfloor(fy);
+        int pz = stb__perlin_fastfloor(fz);
+
+        fx = _mm_sub_ps(fx, _mm_cvtepi32_ps(px));
+        fy -= py;
+        fz -= pz;
+
+        __m128 u = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_sub_ps(_mm_mul_ps(fx, _mm_set1_ps(6.0f)), _mm_set1_ps(15.0f)), fx), _mm_set1_ps(10.0f)), fx), fx), fx);
+        __m128 v = _mm_set1_ps((((fy*6 - 15)*fy + 10)*fy*fy*fy));
+        __m128 w = _mm_set1_ps((((fz*6 - 15)*fz + 10)*fz*fz*fz));
+
+        int lattice[4];
+        _mm_storeu_si128((__m128i *)lattice, px);
+
+        // Corners gradients, lanes gathered from hash tables
+        // NOTE: Neighbor pixels mostly share lattice cell, last cell gradients are kept by octave
+        float corners[8][3][4];
+
+        for (int lane = 0; lane < 4; lane++)
+        {
+            if (lattice[lane] != cache->lattice[octave])
+            {
+                int r0 = stb__perlin_randtab[(lattice[lane] & 255) + octave];
+                int r1 = stb__perlin_randtab[((lattice[lane] + 1) & 255) + octave];
+                int hashes[4] = {
+                    stb__perlin_randtab[r0 + (py & 255)], stb__perlin_randtab[r0 + ((py + 1) & 255)],
+                    stb__perlin_randtab[r1 + (py & 255)], stb__perlin_randtab[r1 + ((py + 1) & 255)]
+                };
+
+                for (int c = 0; c < 8; c++) cache->gradients[octave][c] = stb__perlin_randtab_grad_idx[hashes[c/2] + (((c%2) == 0)? (pz & 255) : ((pz + 1) & 255))];
+
+                cache->lattice[octave] = lattice[lane];
+            }
+
+            for (int c = 0; c < 8; c++)
+            {
+                const float *gradient = gradients[cache->gradients[octave][c]];
+
+                corners[c][0][lane] = gradient[0];
+                corners[c][1][lane] = gradient[1];
+                corners[c][2][lane] = gradient[2];
+            }
+        }
+
+        // Corners dot products, corner c = (x + c/4, y + (c/2)%2, z + c%2)
+        __m128 n[8];
+
+        for (int c = 0; c < 8; c++)
+        {
+            __m128 cx = ((c/4) == 0)? fx : _mm_sub_ps(fx, one);
+            __m128 cy = _mm_set1_ps((((c/2)%2) == 0)? fy : fy - 1);
+            __m128 cz = _mm_set1_ps(((c%2) == 0)? fz : fz - 1);
+
+            n[c] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(corners[c][0]), cx), _mm_mul_ps(_mm_loadu_ps(corners[c][1]), cy)), _mm_mul_ps(_mm_loadu_ps(corners[c][2]), cz));
+        }
+
+        #define PERLIN_LERP(a, b, t) _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), t))
+        __m128 n0 = PERLIN_LERP(PERLIN_LERP(n[0], n[1], w), PERLIN_LERP(n[2], n[3], w), v);
+        __m128 n1 = PERLIN_LERP(PERLIN_LERP(n[4], n[5], w), PERLIN_LERP(n[6], n[7], w), v);
+        __m128 result = PERLIN_LERP(n0, n1, u);
+        #undef PERLIN_LERP
+
+        sum = _mm_add_ps(sum, _mm_mul_ps(result, _mm_set1_ps(amplitude)));
+        frequency *= 2.0f;
+        amplitude *= 0.5f;
+    }
+
+    _mm_storeu_ps(noise, sum);
+#else
+    (void)cache;
+    for (int i = 0; i < 4; i++) noise[i] = stb_perlin_fbm_noise3(x[i], y, 1.0f, 2.0f, 0.5f, 6);
+#endif
+}
+
+// Generation job: perlin noise rows, 4 pixels at a time
+static void GenPerlinNoiseRows(void *data)
+{
+    ImageGenerationJob *job = (ImageGenerationJob *)data;
+
+    for (int y = job->firstRow; y < job->firstRow + job->rowsCount; y++)
+    {
+        float ny = (float)(y + job->offsetY)*job->scale/(float)job->height;
+        PerlinNoiseCache cache = { { INT_MIN, INT_MIN, INT_MIN, INT_MIN, INT_MIN, INT_MIN } };
+
+        for (int x = 0; x < job->width; x += 4)
+        {
+            float nx[4];
+            float noise[4];
+
+            // NOTE: Last pixels of the row repeated to fill 4 values
+            for (int i = 0; i < 4; i++) nx[i] = (float)(((x + i < job->width)? x + i : job->width - 1) + job->offsetX)*job->scale/(float)job->width;
+
+            // Typical values to start playing with:
+            //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
+            //   gain       =  0.5   -- relative weighting applied to each successive octave
+            //   octaves    =  6     -- number of "octaves" of noise3() to sum
+            PerlinNoiseFbm4(nx, ny, &cache, noise);
+
+            for (int i = 0; (i < 4) && (x + i < job->width); i++)
+            {
+                // NOTE: We need to translate the data from [-1..1] to [0..1]
+                float p = (noise[i] + 1.0f)/2.0f;
+
+                int intensity = (int)(p*255.0f);
+                job->pixels[y*job->width + x + i] = (Color){ intensity, intensity, intensity, 255 };
+            }
+        }
+    }
+}
+
+// Generation job: cellular rows, distance to nearest seed of adjacent tiles
+// NOTE: Nearest seed searched on squared integer distances, square root computed once per pixel
+static void GenCellularRows(void *data)
+{
+    ImageGenerationJob *job = (ImageGenerationJob *)data;
+
+    for (int y = job->firstRow; y < job->firstRow + job->rowsCount; y++)
+    {
+        int tileY = y/job->tileSize;
+
+        for (int x = 0; x < job->width; x++)
+        {
+            int tileX = x/job->tileSize;
+            int minDistance = -1;       // Squared distance, -1 if no seed found
+
+            // Check all adjacent tiles
+            for (int j = -1; j < 2; j++)
+            {
+                if ((tileY + j < 0) || (tileY + j >= job->seedsPerCol)) continue;
+
+                for (int i = -1; i < 2; i++)
+                {
+                    if ((tileX + i < 0) || (tileX + i >= job->seedsPerRow)) continue;
+
+                    Vector2 neighborSeed = job->seeds[(tileY + j)*job->seedsPerRow + tileX + i];
+                    int dx = x - (int)neighborSeed.x;
+                    int dy = y - (int)neighborSeed.y;
+
+                    if ((minDistance < 0) || (dx*dx + dy*dy < minDistance)) minDistance = dx*dx + dy*dy;
+                }
+            }
+
+            // I made this up but it seems to give good results at all tile sizes
+            int intensity = 255;
+            if (minDistance >= 0) intensity = (int)((float)sqrt((double)minDistance)*256.0f/job->tileSize);
+            if (intensity > 255) intensity = 255;
+
+            job->pixels[y*job->width + x] = (Color){ intensity, intensity, intensity, 255 };
+        }
+    }
+}
+#endif      // SUPPORT_IMAGE_GENERATION
+
+// Get pixel data from image as Vector4 array (float normalized)
+static Vector4 *LoadImageDataNormalized(Image image)
+{
+    Vector4 *pixels = (Vector4 *)RL_MALLOC(image.width*image.height*sizeof(Vector4));
+
+    if (image.format >= COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
+    else
+    {
+        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        {
+            switch (image.format)
+            {
+                case UNCOMPRESSED_GRAYSCALE:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].w = 1.0f;
+
+                } break;
+                case UNCOMPRESSED_GRAY_ALPHA:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].w = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+
+                    k += 2;
+                } break;
+                case UNCOMPRESSED_R5G5B5A1:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                    pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
+                    pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
+                    pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
+
+                } break;
+                case UNCOMPRESSED_R5G6B5:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                    pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
+                    pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
+                    pixels[i].w = 1.0f;
+
+                } break;
+                case UNCOMPRESSED_R4G4B4A4:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
+                    pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
+                    pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
+                    pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
+
+                } break;
+                case UNCOMPRESSED_R8G8B8A8:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
+                    pixels[i].w = (float)((unsigned char *)image.data)[k + 3]/255.0f;
+
+                    k += 4;
+                } break;
+                case UNCOMPRESSED_R8G8B8:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
+                    pixels[i].w = 1.0f;
+
+                    k += 3;
+                } break;
+                case UNCOMPRESSED_R32:
+                {
+                    pixels[i].x = ((float *)image.data)[k];
+                    pixels[i].y = 0.0f;
+                    pixels[i].z = 0.0f;
+                    pixels[i].w = 1.0f;
+
+                } break;
+                case UNCOMPRESSED_R32G32B32:
+                {
+                    pixels[i].x = ((float *)image.data)[k];
+                    pixels[i].y = ((float *)image.data)[k + 1];
+                    pixels[i].z = ((float *)image.data)[k + 2];
+                    pixels[i].w = 1.0f;
+
+                    k += 3;
+                } break;
+                case UNCOMPRESSED_R32G32B32A32:
+                {
+                    pixels[i].x = ((float *)image.data)[k];
+                    pixels[i].y = ((float *)image.data)[k + 1];
+                    pixels[i].z = ((float *)image.data)[k + 2];
+                    pixels[i].w = ((float *)image.data)[k + 3];
+
+                    k += 4;
+                }
+                default: break;
+            }
+        }
+    }
+
+    return pixels;
+}
+
+// Get image alpha border rectangle
+// NOTE: Threshold is defined as a percentatge: 0.0f -> 1.0f
+Rectangle GetImageAlphaBorder(Image image, float threshold)
+{
+    Rectangle crop = { 0 };
+
+    Color *pixels = LoadImageColors(image);
+
+    if (pixels != NULL)
+    {
+        int xMin = 65536;   // Define a big enough number
+        int xMax = 0;
+        int yMin = 65536;
+        int yMax = 0;
+
+        for (int y = 0; y < image.height; y++)
+        {
+            for (int x = 0; x < image.width; x++)
+            {
+                if (pixels[y*image.width + x].a > (unsigned char)(threshold*255.0f))
+                {
+                    if (x < xMin) xMin = x;
+                    if (x > xMax) xMax = x;
+                    if (y < yMin) yMin = y;
+                    if (y > yMax) yMax = y;
+                }
+            }
+        }
+
+        // Check for empty blank image
+        if ((xMin != 65536) && (xMax != 65536))
+        {
+            crop = (Rectangle){ (float)xMin, (float)yMin, (float)((xMax + 1) - xMin), (float)((yMax + 1) - yMin) };
+        }
+
+        UnloadImageColors(pixels);
+    }
+
+    return crop;
+}
+
+// Get image peak signal-to-noise ratio (dB) compared to reference image, on RGBA channels
+// NOTE: Useful to measure lossy conversions quality (i.e. DXT compression), returns INFINITY if images are equal
+float GetImagePSNR(Image image, Image reference)
+{
+    if ((image.width != reference.width) || (image.height != reference.height))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Images size do not match, PSNR can not be computed");
+        return 0.0f;
+    }
+
+    Color *pixels = LoadImageColors(image);
+    Color *referencePixels = LoadImageColors(reference);
+
+    if ((pixels == NULL) || (referencePixels == NULL)) return 0.0f;
+
+    double error = 0.0;
+
+    for (int i = 0; i < image.width*image.height; i++)
+    {
+        int dr = pixels[i].r - referencePixels[i].r;
+        int dg = pixels[i].g - referencePixels[i].g;
+        int db = pixels[i].b - referencePixels[i].b;
+        int da = pixels[i].a - referencePixels[i].a;
+
+        error += dr*dr + dg*dg + db*db + da*da;
+    }
+
+    UnloadImageColors(pixels);
+    UnloadImageColors(referencePixels);
+
+    if (error == 0.0) return INFINITY;
+
+    double meanError = error/((double)image.width*image.height*4);
+
+    return (float)(10.0*log10(255.0*255.0/meanError));
+}
+
+//------------------------------------------------------------------------------------
+// Image drawing functions
+//------------------------------------------------------------------------------------
 // Clear image background with given color
 void ImageClearBackground(Image *dst, Color color)
 {
-    for (int i = 0; i < dst->width*dst->height; ++i) ImageDrawPixel(dst, i%dst->width, i/dst->height, color);
+    ImageDrawRectangle(dst, 0, 0, dst->width, dst->height, color);
 }
 
 // Draw pixel within an image
@@ -2471,16 +4051,28 @@ void ImageDrawPixelV(Image *dst, Vector2 position, Color color)
 }
 
 // Draw line within an image
+// NOTE: Pixels on same row are filled as one span
 void ImageDrawLine(Image *dst, int startPosX, int startPosY, int endPosX, int endPosY, Color color)
 {
+    unsigned char pixel[16] = { 0 };
+    int bytesPerPixel = GetPixelPacked(color, dst->format, pixel);
+
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (bytesPerPixel == 0)) return;
+
     int m = 2*(endPosY - startPosY);
     int slopeError = m - (endPosX - startPosX);
 
-    for (int x = startPosX, y = startPosY; x <= endPosX; x++)
+    for (int x = startPosX, y = startPosY, spanX = startPosX; x <= endPosX; x++)
     {
-        ImageDrawPixel(dst, x, y, color);
         slopeError += m;
 
+        if ((slopeError >= 0) || (x == endPosX))
+        {
+            ImageFillSpan(dst, spanX, y, x - spanX + 1, pixel, bytesPerPixel);
+            spanX = x + 1;
+        }
+
         if (slopeError >= 0)
         {
             y++;
@@ -2498,19 +4090,25 @@ void ImageDrawLineV(Image *dst, Vector2 start, Vector2 end, Color color)
 // Draw circle within an image
 void ImageDrawCircle(Image *dst, int centerX, int centerY, int radius, Color color)
 {
+    unsigned char pixel[16] = { 0 };
+    int bytesPerPixel = GetPixelPacked(color, dst->format, pixel);
+
+    // Security check to avoid program crash
+    if ((dst->data == NULL) || (bytesPerPixel == 0)) return;
+
     int x = 0, y = radius;
     int decesionParameter = 3 - 2*radius;
 
     while (y >= x)
     {
-        ImageDrawPixel(dst, centerX + x, centerY + y, color);
-        ImageDrawPixel(dst, centerX - x, centerY + y, color);
-        ImageDrawPixel(dst, centerX + x, centerY - y, color);
-        ImageDrawPixel(dst, centerX - x, centerY - y, color);
-        ImageDrawPixel(dst, centerX + y, centerY + x, color);
-        ImageDrawPixel(dst, centerX - y, centerY + x, color);
-        ImageDrawPixel(dst, centerX + y, centerY - x, color);
-        ImageDrawPixel(dst, centerX - y, centerY - x, color);
+        ImageFillSpan(dst, centerX + x, centerY + y, 1, pixel, bytesPerPixel);
+        ImageFillSpan(dst, centerX - x, centerY + y, 1, pixel, bytesPerPixel);
+        ImageFillSpan(dst, centerX + x, centerY - y, 1, pixel, bytesPerPixel);
+        ImageFillSpan(dst, centerX - x, centerY - y, 1, pixel, bytesPerPixel);
+        ImageFillSpan(dst, centerX + y, centerY + x, 1, pixel, bytesPerPixel);
+        ImageFillSpan(dst, centerX - y, centerY + x, 1, pixel, bytesPerPixel);
+        ImageFillSpan(dst, centerX + y, centerY - x, 1, pixel, bytesPerPixel);
+        ImageFillSpan(dst, centerX - y, centerY - x, 1, pixel, bytesPerPixel);
         x++;
 
         if (decesionParameter > 0)
@@ -2552,13 +4150,23 @@ void ImageDrawRectangleRec(Image *dst, Rectangle rec, Color color)
     int sx = (int)rec.x;
     int ex = sx + (int)rec.width;
 
-    for (int y = sy; y < ey; y++)
-    {
-        for (int x = sx; x < ex; x++)
-        {
-            ImageDrawPixel(dst, x, y, color);
-        }
-    }
+    // Clip rectangle to image bounds
+    if (sx < 0) sx = 0;
+    if (sy < 0) sy = 0;
+    if (ex > dst->width) ex = dst->width;
+    if (ey > dst->height) ey = dst->height;
+
+    unsigned char pixel[16] = { 0 };
+    int bytesPerPixel = GetPixelPacked(color, dst->format, pixel);
+
+    if ((sx >= ex) || (sy >= ey) || (bytesPerPixel == 0)) return;
+
+    // First row filled with packed pixel, next rows copied from first one
+    ImageFillSpan(dst, sx, sy, ex - sx, pixel, bytesPerPixel);
+
+    unsigned char *row = (unsigned char *)dst->data + ((size_t)sy*dst->width + sx)*bytesPerPixel;
+
+    for (int y = sy + 1; y < ey; y++) memcpy((unsigned char *)dst->data + ((size_t)y*dst->width + sx)*bytesPerPixel, row, (ex - sx)*bytesPerPixel);
 }
 
 // Draw rectangle lines within an image
@@ -2633,6 +4241,7 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
         //    [x] Optimize ColorAlphaBlend() for faster operations (maybe avoiding divs?)
         //    [x] Consider fast path: no alpha blending required cases (src has no alpha)
         //    [x] Consider fast path: same src/dst format with no alpha -> direct line copy
+        //    [x] Consider fast path: 32bit RGBA src/dst blending by row, SIMD
         //    [-] GetPixelColor(): Return Vector4 instead of Color, easier for ColorAlphaBlend()
 
         Color colSrc, colDst, blend;
@@ -2657,6 +4266,8 @@ void ImageDraw(Image *dst, Image src, Rectangle srcRec, Rectangle dstRec, Color
 
             // Fast path: Avoid moving pixel by pixel if no blend required and same format
             if (!blendRequired && (srcPtr->format == dst->format)) memcpy(pDst, pSrc, (int)(srcRec.width)*bytesPerPixelSrc);
+            // Fast path: 32bit RGBA blending, processed by row (vectorized if supported)
+            else if ((srcPtr->format == UNCOMPRESSED_R8G8B8A8) && (dst->format == UNCOMPRESSED_R8G8B8A8)) BlendPixelsRGBA(pDst, pSrc, (int)srcRec.width, tint);
             else
             {
                 for (int x = 0; x < (int)srcRec.width; x++)
@@ -3800,6 +5411,9 @@ int GetPixelDataSize(int width, int height, int format)
 
     dataSize = width*height*bpp/8;  // Total data size in bytes
 
+    // DXT formats store partial 4x4 blocks (width or height not multiple of 4) as full blocks
+    if ((format >= COMPRESSED_DXT1_RGB) && (format <= COMPRESSED_DXT5_RGBA)) dataSize = ((width + 3)/4)*((height + 3)/4)*bpp*2;
+
     // Most compressed formats works on 4x4 blocks,
     // if texture is smaller, minimum dataSize is 8 or 16
     if ((width < 4) && (height < 4))
@@ -3981,14 +5595,6 @@ static Image LoadDDS(const unsigned char *fileData, unsigned int fileSize)
             {
                 int dataSize = 0;
 
-                // Calculate data size, including all mipmaps
-                if (ddsHeader->mipmapCount > 1) dataSize = ddsHeader->pitchOrLinearSize*2;
-                else dataSize = ddsHeader->pitchOrLinearSize;
-
-                image.data = (unsigned char *)RL_MALLOC(dataSize*sizeof(unsigned char));
-
-                memcpy(image.data, fileDataPtr, dataSize);
-
                 switch (ddsHeader->ddspf.fourCC)
                 {
                     case FOURCC_DXT1:
@@ -4000,12 +5606,145 @@ static Image LoadDDS(const unsigned char *fileData, unsigned int fileSize)
                     case FOURCC_DXT5: image.format = COMPRESSED_DXT5_RGBA; break;
                     default: break;
                 }
+
+                // Calculate data size, including all mipmaps
+                // NOTE: Size limited to file data, in case of missing mipmaps
+                for (int i = 0, width = image.width, height = image.height; i < image.mipmaps; i++, width = (width > 1)? width/2 : 1, height = (height > 1)? height/2 : 1)
+                {
+                    dataSize += GetPixelDataSize(width, height, image.format);
+                }
+
+                if (dataSize > (int)(fileSize - 4 - sizeof(DDSHeader))) dataSize = (int)(fileSize - 4 - sizeof(DDSHeader));
+
+                image.data = (unsigned char *)RL_MALLOC(dataSize*sizeof(unsigned char));
+
+                memcpy(image.data, fileDataPtr, dataSize);
             }
         }
     }
 
     return image;
 }
+
+// Save image data as DDS file
+// NOTE: DXT compressed formats are saved with all mipmaps, other formats are saved as 32bit BGRA (base level only)
+static int SaveDDS(Image image, const char *fileName)
+{
+    // DDS Pixel Format
+    typedef struct {
+        unsigned int size;
+        unsigned int flags;
+        unsigned int fourCC;
+        unsigned int rgbBitCount;
+        unsigned int rBitMask;
+        unsigned int gBitMask;
+        unsigned int bBitMask;
+        unsigned int aBitMask;
+    } DDSPixelFormat;
+
+    // DDS Header (124 bytes)
+    typedef struct {
+        unsigned int size;
+        unsigned int flags;
+        unsigned int height;
+        unsigned int width;
+        unsigned int pitchOrLinearSize;
+        unsigned int depth;
+        unsigned int mipmapCount;
+        unsigned int reserved1[11];
+        DDSPixelFormat ddspf;
+        unsigned int caps;
+        unsigned int caps2;
+        unsigned int caps3;
+        unsigned int caps4;
+        unsigned int reserved2;
+    } DDSHeader;
+
+    bool compressed = (image.format >= COMPRESSED_DXT1_RGB) && (image.format <= COMPRESSED_DXT5_RGBA);
+    int mipmaps = compressed? image.mipmaps : 1;
+    int dataSize = 0;
+
+    if (!compressed && (image.format >= COMPRESSED_DXT1_RGB))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Compressed format not supported for DDS export (%i)", image.format);
+        return 0;
+    }
+
+    for (int i = 0, width = image.width, height = image.height; i < mipmaps; i++, width = (width > 1)? width/2 : 1, height = (height > 1)? height/2 : 1)
+    {
+        dataSize += compressed? GetPixelDataSize(width, height, image.format) : width*height*4;
+    }
+
+    unsigned char *fileData = (unsigned char *)RL_CALLOC(4 + sizeof(DDSHeader) + dataSize, 1);
+
+    DDSHeader ddsHeader = { 0 };
+
+    ddsHeader.size = sizeof(DDSHeader);
+    ddsHeader.flags = 0x1007;               // DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT
+    ddsHeader.height = image.height;
+    ddsHeader.width = image.width;
+    ddsHeader.mipmapCount = mipmaps;
+    ddsHeader.ddspf.size = sizeof(DDSPixelFormat);
+    ddsHeader.caps = 0x1000;                // DDSCAPS_TEXTURE
+
+    if (mipmaps > 1)
+    {
+        ddsHeader.flags |= 0x20000;         // DDSD_MIPMAPCOUNT
+        ddsHeader.caps |= 0x400008;         // DDSCAPS_MIPMAP | DDSCAPS_COMPLEX
+    }
+
+    if (compressed)
+    {
+        ddsHeader.flags |= 0x80000;         // DDSD_LINEARSIZE
+        ddsHeader.pitchOrLinearSize = GetPixelDataSize(image.width, image.height, image.format);
+        ddsHeader.ddspf.flags = (image.format == COMPRESSED_DXT1_RGBA)? 0x05 : 0x04;    // DDPF_FOURCC (| DDPF_ALPHAPIXELS)
+
+        switch (image.format)
+        {
+            case COMPRESSED_DXT1_RGB:
+            case COMPRESSED_DXT1_RGBA: ddsHeader.ddspf.fourCC = 0x31545844; break;  // "DXT1"
+            case COMPRESSED_DXT3_RGBA: ddsHeader.ddspf.fourCC = 0x33545844; break;  // "DXT3"
+            case COMPRESSED_DXT5_RGBA: ddsHeader.ddspf.fourCC = 0x35545844; break;  // "DXT5"
+            default: break;
+        }
+
+        memcpy(fileData + 4 + sizeof(DDSHeader), image.data, dataSize);
+    }
+    else
+    {
+        ddsHeader.flags |= 0x8;             // DDSD_PITCH
+        ddsHeader.pitchOrLinearSize = image.width*4;
+        ddsHeader.ddspf.flags = 0x41;       // DDPF_RGB | DDPF_ALPHAPIXELS
+        ddsHeader.ddspf.rgbBitCount = 32;
+        ddsHeader.ddspf.rBitMask = 0x00ff0000;
+        ddsHeader.ddspf.gBitMask = 0x0000ff00;
+        ddsHeader.ddspf.bBitMask = 0x000000ff;
+        ddsHeader.ddspf.aBitMask = 0xff000000;
+
+        // NOTE: DirectX 32bit ARGB DWORD is stored as B8G8R8A8 in memory
+        Color *pixels = LoadImageColors(image);
+        unsigned char *fileDataPtr = fileData + 4 + sizeof(DDSHeader);
+
+        for (int i = 0; i < image.width*image.height; i++)
+        {
+            fileDataPtr[i*4] = pixels[i].b;
+            fileDataPtr[i*4 + 1] = pixels[i].g;
+            fileDataPtr[i*4 + 2] = pixels[i].r;
+            fileDataPtr[i*4 + 3] = pixels[i].a;
+        }
+
+        UnloadImageColors(pixels);
+    }
+
+    memcpy(fileData, "DDS ", 4);
+    memcpy(fileData + 4, &ddsHeader, sizeof(DDSHeader));
+
+    int success = SaveFileData(fileName, fileData, 4 + sizeof(DDSHeader) + dataSize);
+
+    RL_FREE(fileData);
+
+    return success;
+}
 #endif
 
 #if defined(SUPPORT_FILEFORMAT_PKM)
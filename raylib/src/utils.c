@@ -8,6 +8,10 @@
 *       Show TraceLog() output messages
 *       NOTE: By default LOG_DEBUG traces not shown
 *
+*   #define SUPPORT_MEMORY_MAPPED_FILES
+*       Asset packs (LoadAssetPack()) are memory mapped, packed files data is read in place by the OS pager,
+*       defined by default on all platforms but PLATFORM_WEB and PLATFORM_ANDROID (pack loaded in memory)
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -30,6 +34,10 @@
 *
 **********************************************************************************************/
 
+#if defined(__linux__) && !defined(_DEFAULT_SOURCE)
+    #define _DEFAULT_SOURCE             // Required for: sysconf(_SC_NPROCESSORS_ONLN) if compiled with c99 without gnu ext.
+#endif
+
 #include "raylib.h"                     // WARNING: Required for: LogType enum
 
 // Check if config flags have been externally provided on compilation line
@@ -50,6 +58,62 @@
 #include <stdarg.h>                     // Required for: va_list, va_start(), va_end()
 #include <string.h>                     // Required for: strcpy(), strcat()
 
+#if !defined(PLATFORM_WEB)
+    #define SUPPORT_THREADS             // Worker threads available, otherwise jobs run on calling thread
+#endif
+#if !defined(PLATFORM_WEB) && !defined(PLATFORM_ANDROID)
+    #define SUPPORT_MEMORY_MAPPED_FILES // Asset packs memory mapped, otherwise loaded with LoadFileData()
+#endif
+
+#if (defined(PLATFORM_DESKTOP) || defined(PLATFORM_UWP)) && defined(_WIN32) && (defined(_MSC_VER) || defined(__TINYC__))
+    #define DIRENT_MALLOC RL_MALLOC
+    #define DIRENT_FREE RL_FREE
+
+    #include "external/dirent.h"        // Required for: DIR, opendir(), closedir() [Used in ExportAssetPack()]
+#else
+    #include <dirent.h>                 // Required for: DIR, opendir(), closedir() [Used in ExportAssetPack()]
+#endif
+
+#if defined(SUPPORT_MEMORY_MAPPED_FILES)
+#if defined(_WIN32)
+    // NOTE: Win32 file mapping functions are declared here to avoid windows.h inclusion (symbols conflict with raylib)
+    __declspec(dllimport) void *__stdcall CreateFileA(const char *fileName, unsigned long access, unsigned long shareMode, void *security, unsigned long creation, unsigned long flags, void *templateFile);
+    __declspec(dllimport) int __stdcall GetFileSizeEx(void *file, long long *size);
+    __declspec(dllimport) void *__stdcall CreateFileMappingA(void *file, void *security, unsigned long protect, unsigned long sizeHigh, unsigned long sizeLow, const char *name);
+    __declspec(dllimport) void *__stdcall MapViewOfFile(void *mapping, unsigned long access, unsigned long offsetHigh, unsigned long offsetLow, size_t bytes);
+    __declspec(dllimport) int __stdcall UnmapViewOfFile(const void *address);
+    __declspec(dllimport) int __stdcall CloseHandle(void *handle);
+#else
+    #include <sys/mman.h>               // Required for: mmap(), munmap()
+    #include <sys/stat.h>               // Required for: fstat()
+    #include <fcntl.h>                  // Required for: open()
+    #include <unistd.h>                 // Required for: close()
+#endif
+#endif  // SUPPORT_MEMORY_MAPPED_FILES
+
+#if defined(SUPPORT_THREADS)
+#if defined(_WIN32)
+    // NOTE: Win32 threading functions are declared here to avoid windows.h inclusion (symbols conflict with raylib)
+    typedef struct { void *ptr; } RL_SRWLOCK;
+    typedef struct { void *ptr; } RL_CONDITION_VARIABLE;
+
+    __declspec(dllimport) void __stdcall InitializeSRWLock(RL_SRWLOCK *lock);
+    __declspec(dllimport) void __stdcall AcquireSRWLockExclusive(RL_SRWLOCK *lock);
+    __declspec(dllimport) void __stdcall ReleaseSRWLockExclusive(RL_SRWLOCK *lock);
+    __declspec(dllimport) void __stdcall InitializeConditionVariable(RL_CONDITION_VARIABLE *cond);
+    __declspec(dllimport) int __stdcall SleepConditionVariableSRW(RL_CONDITION_VARIABLE *cond, RL_SRWLOCK *lock, unsigned long ms, unsigned long flags);
+    __declspec(dllimport) void __stdcall WakeConditionVariable(RL_CONDITION_VARIABLE *cond);
+    __declspec(dllimport) void __stdcall WakeAllConditionVariable(RL_CONDITION_VARIABLE *cond);
+    __declspec(dllimport) void *__stdcall CreateThread(void *attribs, size_t stackSize, unsigned long (__stdcall *func)(void *), void *param, unsigned long flags, unsigned long *id);
+    __declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long ms);
+    __declspec(dllimport) int __stdcall CloseHandle(void *handle);
+    __declspec(dllimport) unsigned long __stdcall GetActiveProcessorCount(unsigned short group);
+#else
+    #include <pthread.h>                // Required for: pthread_create(), pthread_join(), pthread_mutex_*(), pthread_cond_*()
+    #include <unistd.h>                 // Required for: sysconf()
+#endif
+#endif  // SUPPORT_THREADS
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -59,6 +123,111 @@
 #ifndef MAX_UWP_MESSAGES
     #define MAX_UWP_MESSAGES            512     // Max UWP messages to process
 #endif
+#ifndef MAX_WORKER_THREADS
+    #define MAX_WORKER_THREADS           64     // Max worker threads used by a job queue or a parallel run
+#endif
+#ifndef MAX_ASSET_PACK_FILES
+    #define MAX_ASSET_PACK_FILES        512     // Max files packed by ExportAssetPack()
+#endif
+
+// Asset pack file format (little endian), files sorted by name for binary search:
+//   header:  "rPAK" | version (uint) | files count (uint) | reserved (uint)
+//   index:   one entry per file: name relative to packed directory ('/' separators, '\0' terminated) | offset (uint) | size (uint)
+//   data:    files data, every file aligned to ASSET_PACK_ALIGNMENT and followed by at least one '\0' byte
+#define ASSET_PACK_VERSION                1
+#define ASSET_PACK_NAME_LENGTH          120     // Max packed file name length (including '\0')
+#define ASSET_PACK_ALIGNMENT             64     // Packed files data alignment (bytes)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+#if defined(SUPPORT_THREADS)
+#if defined(_WIN32)
+typedef void *ThreadHandle;
+typedef RL_SRWLOCK ThreadLock;
+typedef RL_CONDITION_VARIABLE ThreadCond;
+#define THREAD_LOCK_INITIALIZER { 0 }                   // SRWLOCK_INIT
+#else
+typedef pthread_t ThreadHandle;
+typedef pthread_mutex_t ThreadLock;
+typedef pthread_cond_t ThreadCond;
+#define THREAD_LOCK_INITIALIZER PTHREAD_MUTEX_INITIALIZER
+#endif
+#endif
+
+// Mutex, platform lock wrapper
+struct Mutex {
+#if defined(SUPPORT_THREADS)
+    ThreadLock lock;
+#endif
+    int unused;
+};
+
+// Asset pack file header
+typedef struct AssetPackHeader {
+    char id[4];                         // Pack identifier: "rPAK"
+    unsigned int version;               // Pack format version
+    unsigned int filesCount;            // Number of packed files
+    unsigned int reserved;              // Reserved, set to 0
+} AssetPackHeader;
+
+// Asset pack index entry
+typedef struct AssetPackEntry {
+    char name[ASSET_PACK_NAME_LENGTH];  // File name, relative to packed directory
+    unsigned int offset;                // File data offset from pack start
+    unsigned int size;                  // File data size (bytes)
+} AssetPackEntry;
+
+// Queued job
+typedef struct Job {
+    JobFunc func;                       // Job function
+    void *data;                         // Job data (owned by caller)
+} Job;
+
+// Job queue: bounded FIFO of jobs consumed by worker threads
+struct JobQueue {
+    Job *jobs;                          // Jobs ring buffer
+    int capacity;                       // Jobs ring buffer capacity
+    int head;                           // Next job to process
+    int count;                          // Jobs queued (not yet started)
+    int running;                        // Jobs being processed
+    bool exit;                          // Workers exit request
+#if defined(SUPPORT_THREADS)
+    ThreadLock lock;                    // Queue lock
+    ThreadCond jobAvailable;            // Signaled when a job is queued or exit requested
+    ThreadCond jobsDone;                // Signaled when queue becomes empty and idle
+    ThreadHandle threads[MAX_WORKER_THREADS];
+#endif
+    int threadCount;                    // Worker threads count (0: jobs run on calling thread)
+};
+
+// Parallel run shared state
+typedef struct ParallelRun {
+    JobFunc func;                       // Function run for every job
+    unsigned char *jobs;                // Jobs data array
+    int jobSize;                        // Size of one job data
+    int jobCount;                       // Jobs count
+    int nextJob;                        // Next job to run
+#if defined(SUPPORT_THREADS)
+    ThreadLock lock;                    // Lock for nextJob
+#endif
+} ParallelRun;
+
+#if defined(SUPPORT_THREADS)
+// Parallel runs worker threads, started by first run and kept for next ones
+// NOTE: Pool serves one run at a time, threads wait for next run until program exit
+typedef struct ParallelPool {
+    ThreadLock lock;                    // Pool lock (statically initialized)
+    ThreadCond runAvailable;            // Signaled when current run wants helper threads
+    ThreadCond runDone;                 // Signaled when last helper thread leaves current run
+    bool initialized;                   // Condition variables initialized
+    ThreadHandle threads[MAX_WORKER_THREADS];
+    int threadCount;                    // Worker threads started
+    ParallelRun *run;                   // Current run, NULL if pool is idle
+    int helpersWanted;                  // Worker threads still wanted by current run
+    int helpersActive;                  // Worker threads running current run jobs
+} ParallelPool;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -69,6 +238,10 @@ static int logTypeLevel = LOG_INFO;                     // Minimum log type leve
 static int logTypeExit = LOG_ERROR;                     // Log type that exits
 static TraceLogCallback logCallback = NULL;             // Log callback function pointer
 
+#if defined(SUPPORT_THREADS)
+static ParallelPool parallelPool = { THREAD_LOCK_INITIALIZER };     // Worker threads used by RunJobsParallel()
+#endif
+
 #if defined(PLATFORM_ANDROID)
 static AAssetManager *assetManager = NULL;              // Android assets manager pointer
 static const char *internalDataPath = NULL;             // Android internal data path
@@ -87,6 +260,22 @@ static fpos_t android_seek(void *cookie, fpos_t offset, int whence);
 static int android_close(void *cookie);
 #endif
 
+#if defined(SUPPORT_THREADS)
+static void InitThreadLock(ThreadLock *lock);               // Initialize platform lock
+static void CloseThreadLock(ThreadLock *lock);              // Destroy platform lock
+static void AcquireThreadLock(ThreadLock *lock);            // Acquire platform lock
+static void ReleaseThreadLock(ThreadLock *lock);            // Release platform lock
+static void InitThreadCond(ThreadCond *cond);               // Initialize platform condition variable
+static void CloseThreadCond(ThreadCond *cond);              // Destroy platform condition variable
+static void WaitThreadCond(ThreadCond *cond, ThreadLock *lock);  // Wait on condition variable (lock acquired)
+static void SignalThreadCond(ThreadCond *cond, bool all);   // Wake one or all threads waiting on condition variable
+static bool StartThread(ThreadHandle *thread, void (*func)(void *), void *arg);  // Start a thread running func(arg)
+static void JoinThread(ThreadHandle thread);                // Wait for thread termination
+#endif
+static void JobQueueWorker(void *arg);                      // Job queue worker thread loop
+static void ParallelRunWorker(void *arg);                   // Parallel run worker thread loop
+static void ParallelPoolWorker(void *arg);                  // Parallel pool worker thread loop, helps current run
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utilities
 //----------------------------------------------------------------------------------
@@ -324,6 +513,512 @@ bool SaveFileText(const char *fileName, char *text)
     return success;
 }
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Asset pack
+//----------------------------------------------------------------------------------
+
+// Load asset pack file, memory mapped if supported by platform
+// NOTE: Pack index is validated on loading, an empty pack is returned on failure
+AssetPack LoadAssetPack(const char *fileName)
+{
+    AssetPack pack = { 0 };
+
+#if defined(SUPPORT_MEMORY_MAPPED_FILES)
+#if defined(_WIN32)
+    void *file = CreateFileA(fileName, 0x80000000, 0x00000001, NULL, 3, 0x80, NULL);    // GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL
+
+    if (file != (void *)(long long)-1)  // INVALID_HANDLE_VALUE
+    {
+        long long size = 0;
+
+        if (GetFileSizeEx(file, &size) && (size > 0) && (size <= 0xffffffff))
+        {
+            void *mapping = CreateFileMappingA(file, NULL, 0x02, 0, 0, NULL);   // PAGE_READONLY
+
+            if (mapping != NULL)
+            {
+                pack.data = (unsigned char *)MapViewOfFile(mapping, 0x0004, 0, 0, 0);   // FILE_MAP_READ
+                pack.dataSize = (unsigned int)size;
+                CloseHandle(mapping);   // NOTE: Mapped view keeps file mapping alive
+            }
+        }
+
+        CloseHandle(file);
+    }
+#else
+    int file = open(fileName, O_RDONLY);
+
+    if (file != -1)
+    {
+        struct stat info = { 0 };
+
+        if ((fstat(file, &info) == 0) && (info.st_size > 0) && (info.st_size <= 0xffffffff))
+        {
+            void *data = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_SHARED, file, 0);
+
+            if (data != MAP_FAILED)
+            {
+                pack.data = (unsigned char *)data;
+                pack.dataSize = (unsigned int)info.st_size;
+            }
+        }
+
+        close(file);    // NOTE: Mapping keeps file alive
+    }
+#endif
+    pack.mapped = (pack.data != NULL);
+#else
+    pack.data = LoadFileData(fileName, &pack.dataSize);
+#endif
+
+    if (pack.data == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to load asset pack", fileName);
+        return pack;
+    }
+
+    // Validate pack header and index
+    const AssetPackHeader *header = (const AssetPackHeader *)pack.data;
+    bool valid = (pack.dataSize >= sizeof(AssetPackHeader)) && (memcmp(header->id, "rPAK", 4) == 0) && (header->version == ASSET_PACK_VERSION) &&
+                 (header->filesCount <= (pack.dataSize - sizeof(AssetPackHeader))/sizeof(AssetPackEntry));
+
+    if (valid)
+    {
+        const AssetPackEntry *entries = (const AssetPackEntry *)(pack.data + sizeof(AssetPackHeader));
+
+        for (unsigned int i = 0; valid && (i < header->filesCount); i++)
+        {
+            valid = (entries[i].name[ASSET_PACK_NAME_LENGTH - 1] == '\0') && (entries[i].offset <= pack.dataSize) &&
+                    (entries[i].size < pack.dataSize - entries[i].offset);  // NOTE: Data followed by '\0'
+        }
+    }
+
+    if (!valid)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Asset pack not valid", fileName);
+        UnloadAssetPack(pack);
+        return (AssetPack){ 0 };
+    }
+
+    pack.filesCount = (int)header->filesCount;
+
+    TRACELOG(LOG_INFO, "FILEIO: [%s] Asset pack loaded successfully (%i files, %s)", fileName, pack.filesCount, pack.mapped? "memory mapped" : "loaded");
+
+    return pack;
+}
+
+// Unload asset pack, packed files data is not valid anymore
+void UnloadAssetPack(AssetPack pack)
+{
+    if (pack.data == NULL) return;
+
+#if defined(SUPPORT_MEMORY_MAPPED_FILES)
+    if (pack.mapped)
+    {
+    #if defined(_WIN32)
+        UnmapViewOfFile(pack.data);
+    #else
+        munmap(pack.data, pack.dataSize);
+    #endif
+        return;
+    }
+#endif
+
+    UnloadFileData(pack.data);
+}
+
+// Get packed file data, read in place (no copy), NULL if file is not packed
+// NOTE: Data is followed by a '\0' byte, text files data can be used as a string
+const unsigned char *GetAssetPackFileData(AssetPack pack, const char *fileName, unsigned int *dataSize)
+{
+    if (dataSize != NULL) *dataSize = 0;
+    if ((pack.data == NULL) || (fileName == NULL)) return NULL;
+
+    const AssetPackEntry *entries = (const AssetPackEntry *)(pack.data + sizeof(AssetPackHeader));
+    int first = 0;
+    int last = pack.filesCount - 1;
+
+    // Binary search, index is sorted by name
+    while (first <= last)
+    {
+        int middle = (first + last)/2;
+        int result = strcmp(fileName, entries[middle].name);
+
+        if (result == 0)
+        {
+            if (dataSize != NULL) *dataSize = entries[middle].size;
+            return pack.data + entries[middle].offset;
+        }
+        else if (result < 0) last = middle - 1;
+        else first = middle + 1;
+    }
+
+    return NULL;
+}
+
+// Add directory files (recursively) to the list of files to pack, names relative to packed directory
+static int ScanAssetPackFiles(const char *dirPath, const char *relPath, char **names, int count, int capacity)
+{
+    DIR *dir = opendir((relPath[0] == '\0')? dirPath : TextFormat("%s/%s", dirPath, relPath));
+
+    if (dir == NULL) return count;
+
+    struct dirent *entity;
+
+    while ((entity = readdir(dir)) != NULL)
+    {
+        if ((strcmp(entity->d_name, ".") == 0) || (strcmp(entity->d_name, "..") == 0)) continue;
+
+        char name[ASSET_PACK_NAME_LENGTH + 1] = { 0 };
+        int length = snprintf(name, ASSET_PACK_NAME_LENGTH + 1, (relPath[0] == '\0')? "%s%s" : "%s/%s", relPath, entity->d_name);
+
+        if (length >= ASSET_PACK_NAME_LENGTH)
+        {
+            TRACELOG(LOG_WARNING, "FILEIO: [%s/%s] File name too long to be packed", relPath, entity->d_name);
+            continue;
+        }
+
+        DIR *subdir = opendir(TextFormat("%s/%s", dirPath, name));
+
+        if (subdir != NULL)
+        {
+            closedir(subdir);
+            count = ScanAssetPackFiles(dirPath, name, names, count, capacity);
+        }
+        else if (count < capacity) strcpy(names[count++], name);
+        else TRACELOG(LOG_WARNING, "FILEIO: [%s] Too many files to be packed", name);
+    }
+
+    closedir(dir);
+
+    return count;
+}
+
+static int CompareAssetPackNames(const void *a, const void *b)
+{
+    return strcmp(*(const char **)a, *(const char **)b);
+}
+
+// Export all files in directory (recursively) as an asset pack, returns true on success
+// NOTE: Packed files names are relative to directory, using '/' separators: i.e. "images/icon.png"
+bool ExportAssetPack(const char *dirPath, const char *fileName)
+{
+    bool success = false;
+
+    char **names = (char **)RL_MALLOC(MAX_ASSET_PACK_FILES*sizeof(char *));
+    for (int i = 0; i < MAX_ASSET_PACK_FILES; i++) names[i] = (char *)RL_CALLOC(ASSET_PACK_NAME_LENGTH, 1);
+
+    int count = ScanAssetPackFiles(dirPath, "", names, 0, MAX_ASSET_PACK_FILES);
+    qsort(names, count, sizeof(char *), CompareAssetPackNames);
+
+    FILE *file = fopen(fileName, "wb");
+
+    if (file != NULL)
+    {
+        AssetPackHeader header = { { 'r', 'P', 'A', 'K' }, ASSET_PACK_VERSION, 0, 0 };
+        AssetPackEntry *entries = (AssetPackEntry *)RL_CALLOC((count > 0)? count : 1, sizeof(AssetPackEntry));
+        unsigned char **filesData = (unsigned char **)RL_CALLOC((count > 0)? count : 1, sizeof(unsigned char *));
+        unsigned int offset = (unsigned int)(sizeof(AssetPackHeader) + count*sizeof(AssetPackEntry));
+
+        success = true;
+
+        // Load files to compute index, pack file itself is skipped if saved into packed directory
+        for (int i = 0; i < count; i++)
+        {
+            const char *path = TextFormat("%s/%s", dirPath, names[i]);
+            if (strcmp(path, fileName) == 0) continue;
+
+            unsigned int size = 0;
+            filesData[header.filesCount] = LoadFileData(path, &size);
+
+            if (filesData[header.filesCount] == NULL) { success = false; break; }
+
+            offset = (offset + ASSET_PACK_ALIGNMENT - 1)/ASSET_PACK_ALIGNMENT*ASSET_PACK_ALIGNMENT;
+            strcpy(entries[header.filesCount].name, names[i]);
+            entries[header.filesCount].offset = offset;
+            entries[header.filesCount].size = size;
+            offset += size + 1;     // Data followed by '\0'
+            header.filesCount++;
+        }
+
+        if (success)
+        {
+            // NOTE: Index entries not used (skipped files) are written as empty padding
+            static const unsigned char padding[ASSET_PACK_ALIGNMENT] = { 0 };
+            unsigned int position = (unsigned int)(sizeof(AssetPackHeader) + count*sizeof(AssetPackEntry));
+
+            success = (fwrite(&header, sizeof(AssetPackHeader), 1, file) == 1) && (fwrite(entries, sizeof(AssetPackEntry), count, file) == (size_t)count);
+
+            for (unsigned int i = 0; success && (i < header.filesCount); i++)
+            {
+                success = (fwrite(padding, 1, entries[i].offset - position, file) == entries[i].offset - position) &&
+                          (fwrite(filesData[i], 1, entries[i].size, file) == entries[i].size) && (fwrite(padding, 1, 1, file) == 1);
+                position = entries[i].offset + entries[i].size + 1;
+            }
+        }
+
+        for (int i = 0; i < count; i++) UnloadFileData(filesData[i]);
+        RL_FREE(filesData);
+        RL_FREE(entries);
+
+        if (fclose(file) != 0) success = false;
+
+        if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Asset pack exported successfully (%i files)", fileName, header.filesCount);
+        else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export asset pack", fileName);
+    }
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open file", fileName);
+
+    for (int i = 0; i < MAX_ASSET_PACK_FILES; i++) RL_FREE(names[i]);
+    RL_FREE(names);
+
+    return success;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Threading
+//----------------------------------------------------------------------------------
+
+// Get number of logical processors available
+int GetCPUCount(void)
+{
+    int count = 1;
+
+#if defined(SUPPORT_THREADS)
+#if defined(_WIN32)
+    count = (int)GetActiveProcessorCount(0xffff);   // ALL_PROCESSOR_GROUPS
+#else
+    count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+#endif
+
+    if (count < 1) count = 1;
+    if (count > MAX_WORKER_THREADS) count = MAX_WORKER_THREADS;
+
+    return count;
+}
+
+// Load mutex
+Mutex *LoadMutex(void)
+{
+    Mutex *mutex = (Mutex *)RL_CALLOC(1, sizeof(Mutex));
+
+#if defined(SUPPORT_THREADS)
+    InitThreadLock(&mutex->lock);
+#endif
+
+    return mutex;
+}
+
+// Unload mutex
+void UnloadMutex(Mutex *mutex)
+{
+    if (mutex == NULL) return;
+
+#if defined(SUPPORT_THREADS)
+    CloseThreadLock(&mutex->lock);
+#endif
+    RL_FREE(mutex);
+}
+
+// Lock mutex, waits if locked by another thread
+void LockMutex(Mutex *mutex)
+{
+#if defined(SUPPORT_THREADS)
+    AcquireThreadLock(&mutex->lock);
+#endif
+}
+
+// Unlock mutex
+void UnlockMutex(Mutex *mutex)
+{
+#if defined(SUPPORT_THREADS)
+    ReleaseThreadLock(&mutex->lock);
+#endif
+}
+
+// Load job queue: worker threads consuming a bounded FIFO of jobs
+// NOTE: With a single worker thread, jobs are processed in queue order
+JobQueue *LoadJobQueue(int threadCount, int capacity)
+{
+    JobQueue *queue = (JobQueue *)RL_CALLOC(1, sizeof(JobQueue));
+
+    queue->capacity = (capacity > 0)? capacity : 1;
+    queue->jobs = (Job *)RL_CALLOC(queue->capacity, sizeof(Job));
+
+#if defined(SUPPORT_THREADS)
+    if (threadCount > MAX_WORKER_THREADS) threadCount = MAX_WORKER_THREADS;
+
+    InitThreadLock(&queue->lock);
+    InitThreadCond(&queue->jobAvailable);
+    InitThreadCond(&queue->jobsDone);
+
+    for (int i = 0; i < threadCount; i++)
+    {
+        if (!StartThread(&queue->threads[queue->threadCount], JobQueueWorker, queue)) break;
+        queue->threadCount++;
+    }
+
+    if (queue->threadCount < threadCount) TRACELOG(LOG_WARNING, "THREADS: Failed to start %i job queue worker threads", threadCount - queue->threadCount);
+#endif
+
+    return queue;
+}
+
+// Unload job queue, waits for pending jobs to be processed
+void UnloadJobQueue(JobQueue *queue)
+{
+    if (queue == NULL) return;
+
+    WaitJobQueue(queue);
+
+#if defined(SUPPORT_THREADS)
+    AcquireThreadLock(&queue->lock);
+    queue->exit = true;
+    SignalThreadCond(&queue->jobAvailable, true);
+    ReleaseThreadLock(&queue->lock);
+
+    for (int i = 0; i < queue->threadCount; i++) JoinThread(queue->threads[i]);
+
+    CloseThreadCond(&queue->jobsDone);
+    CloseThreadCond(&queue->jobAvailable);
+    CloseThreadLock(&queue->lock);
+#endif
+
+    RL_FREE(queue->jobs);
+    RL_FREE(queue);
+}
+
+// Push a job into the queue, it never blocks
+// NOTE: Returns false if queue is full, job is not queued (caller keeps data ownership)
+bool PushJob(JobQueue *queue, JobFunc func, void *data)
+{
+    if (queue->threadCount == 0)
+    {
+        // No worker threads available: run job on calling thread
+        func(data);
+        return true;
+    }
+
+    bool queued = false;
+
+#if defined(SUPPORT_THREADS)
+    AcquireThreadLock(&queue->lock);
+
+    if (queue->count < queue->capacity)
+    {
+        queue->jobs[(queue->head + queue->count)%queue->capacity] = (Job){ func, data };
+        queue->count++;
+        queued = true;
+
+        SignalThreadCond(&queue->jobAvailable, false);
+    }
+
+    ReleaseThreadLock(&queue->lock);
+#endif
+
+    return queued;
+}
+
+// Get number of jobs queued or being processed
+int GetJobQueuePending(JobQueue *queue)
+{
+    int pending = 0;
+
+#if defined(SUPPORT_THREADS)
+    AcquireThreadLock(&queue->lock);
+    pending = queue->count + queue->running;
+    ReleaseThreadLock(&queue->lock);
+#endif
+
+    return pending;
+}
+
+// Wait until all queued jobs have been processed
+void WaitJobQueue(JobQueue *queue)
+{
+#if defined(SUPPORT_THREADS)
+    if (queue->threadCount == 0) return;
+
+    AcquireThreadLock(&queue->lock);
+    while ((queue->count + queue->running) > 0) WaitThreadCond(&queue->jobsDone, &queue->lock);
+    ReleaseThreadLock(&queue->lock);
+#endif
+}
+
+// Run jobs in parallel and wait for all of them to finish
+// NOTE: jobs is an array of jobCount elements of jobSize bytes, func receives a pointer to one element,
+// calling thread also runs jobs, threadCount <= 0 uses all available processors
+// NOTE: Worker threads are pooled and reused by next runs, a run started while the pool is busy
+// (from another thread or nested in a job) is processed on calling thread
+void RunJobsParallel(JobFunc func, void *jobs, int jobSize, int jobCount, int threadCount)
+{
+    if (jobCount <= 0) return;
+
+    if (threadCount <= 0) threadCount = GetCPUCount();
+    if (threadCount > jobCount) threadCount = jobCount;
+    if (threadCount > MAX_WORKER_THREADS) threadCount = MAX_WORKER_THREADS;
+
+    ParallelRun run = { func, (unsigned char *)jobs, jobSize, jobCount, 0 };
+
+#if defined(SUPPORT_THREADS)
+    if (threadCount > 1)
+    {
+        bool pooled = false;
+
+        AcquireThreadLock(&parallelPool.lock);
+
+        if (parallelPool.run == NULL)
+        {
+            if (!parallelPool.initialized)
+            {
+                InitThreadCond(&parallelPool.runAvailable);
+                InitThreadCond(&parallelPool.runDone);
+                parallelPool.initialized = true;
+            }
+
+            // Pool grows up to the largest run requested, calling thread is one of the workers
+            int started = parallelPool.threadCount;
+            while (parallelPool.threadCount < (threadCount - 1))
+            {
+                if (!StartThread(&parallelPool.threads[parallelPool.threadCount], ParallelPoolWorker, NULL)) break;
+                parallelPool.threadCount++;
+            }
+
+            if (parallelPool.threadCount < (threadCount - 1)) TRACELOG(LOG_WARNING, "THREADS: Failed to start %i parallel run worker threads", threadCount - 1 - parallelPool.threadCount);
+            else if (parallelPool.threadCount > started) TRACELOG(LOG_DEBUG, "THREADS: Parallel run pool started %i worker threads", parallelPool.threadCount - started);
+
+            if (parallelPool.threadCount > 0)
+            {
+                InitThreadLock(&run.lock);
+                parallelPool.run = &run;
+                parallelPool.helpersWanted = ((threadCount - 1) < parallelPool.threadCount)? (threadCount - 1) : parallelPool.threadCount;
+                SignalThreadCond(&parallelPool.runAvailable, true);
+                pooled = true;
+            }
+        }
+
+        ReleaseThreadLock(&parallelPool.lock);
+
+        if (pooled)
+        {
+            ParallelRunWorker(&run);
+
+            // All jobs taken: helper threads not joined yet are not wanted anymore, wait for the running ones
+            AcquireThreadLock(&parallelPool.lock);
+            parallelPool.helpersWanted = 0;
+            while (parallelPool.helpersActive > 0) WaitThreadCond(&parallelPool.runDone, &parallelPool.lock);
+            parallelPool.run = NULL;
+            ReleaseThreadLock(&parallelPool.lock);
+
+            CloseThreadLock(&run.lock);
+            return;
+        }
+    }
+#endif
+
+    for (int i = 0; i < jobCount; i++) func(run.jobs + (size_t)i*jobSize);
+}
+
 #if defined(PLATFORM_ANDROID)
 // Initialize asset manager from android app
 void InitAssetManager(AAssetManager *manager, const char *dataPath)
@@ -394,3 +1089,171 @@ static int android_close(void *cookie)
     return 0;
 }
 #endif  // PLATFORM_ANDROID
+
+#if defined(SUPPORT_THREADS)
+#if defined(_WIN32)
+static void InitThreadLock(ThreadLock *lock) { InitializeSRWLock(lock); }
+static void CloseThreadLock(ThreadLock *lock) { (void)lock; }
+static void AcquireThreadLock(ThreadLock *lock) { AcquireSRWLockExclusive(lock); }
+static void ReleaseThreadLock(ThreadLock *lock) { ReleaseSRWLockExclusive(lock); }
+static void InitThreadCond(ThreadCond *cond) { InitializeConditionVariable(cond); }
+static void CloseThreadCond(ThreadCond *cond) { (void)cond; }
+static void WaitThreadCond(ThreadCond *cond, ThreadLock *lock) { SleepConditionVariableSRW(cond, lock, 0xffffffff, 0); }
+static void SignalThreadCond(ThreadCond *cond, bool all) { if (all) WakeAllConditionVariable(cond); else WakeConditionVariable(cond); }
+
+// Thread entry point wrapper
+typedef struct ThreadStart {
+    void (*func)(void *);
+    void *arg;
+} ThreadStart;
+
+static unsigned long __stdcall ThreadEntry(void *param)
+{
+    ThreadStart start = *(ThreadStart *)param;
+    RL_FREE(param);
+    start.func(start.arg);
+    return 0;
+}
+
+static bool StartThread(ThreadHandle *thread, void (*func)(void *), void *arg)
+{
+    ThreadStart *start = (ThreadStart *)RL_MALLOC(sizeof(ThreadStart));
+    start->func = func;
+    start->arg = arg;
+
+    *thread = CreateThread(NULL, 0, ThreadEntry, start, 0, NULL);
+    if (*thread == NULL) RL_FREE(start);
+
+    return (*thread != NULL);
+}
+
+static void JoinThread(ThreadHandle thread)
+{
+    WaitForSingleObject(thread, 0xffffffff);    // INFINITE
+    CloseHandle(thread);
+}
+#else
+static void InitThreadLock(ThreadLock *lock) { pthread_mutex_init(lock, NULL); }
+static void CloseThreadLock(ThreadLock *lock) { pthread_mutex_destroy(lock); }
+static void AcquireThreadLock(ThreadLock *lock) { pthread_mutex_lock(lock); }
+static void ReleaseThreadLock(ThreadLock *lock) { pthread_mutex_unlock(lock); }
+static void InitThreadCond(ThreadCond *cond) { pthread_cond_init(cond, NULL); }
+static void CloseThreadCond(ThreadCond *cond) { pthread_cond_destroy(cond); }
+static void WaitThreadCond(ThreadCond *cond, ThreadLock *lock) { pthread_cond_wait(cond, lock); }
+static void SignalThreadCond(ThreadCond *cond, bool all) { if (all) pthread_cond_broadcast(cond); else pthread_cond_signal(cond); }
+
+// Thread entry point wrapper
+typedef struct ThreadStart {
+    void (*func)(void *);
+    void *arg;
+} ThreadStart;
+
+static void *ThreadEntry(void *param)
+{
+    ThreadStart start = *(ThreadStart *)param;
+    RL_FREE(param);
+    start.func(start.arg);
+    return NULL;
+}
+
+static bool StartThread(ThreadHandle *thread, void (*func)(void *), void *arg)
+{
+    ThreadStart *start = (ThreadStart *)RL_MALLOC(sizeof(ThreadStart));
+    start->func = func;
+    start->arg = arg;
+
+    bool result = (pthread_create(thread, NULL, ThreadEntry, start) == 0);
+    if (!result) RL_FREE(start);
+
+    return result;
+}
+
+static void JoinThread(ThreadHandle thread)
+{
+    pthread_join(thread, NULL);
+}
+#endif
+#endif  // SUPPORT_THREADS
+
+// Job queue worker thread loop
+static void JobQueueWorker(void *arg)
+{
+#if defined(SUPPORT_THREADS)
+    JobQueue *queue = (JobQueue *)arg;
+
+    AcquireThreadLock(&queue->lock);
+
+    while (true)
+    {
+        while ((queue->count == 0) && !queue->exit) WaitThreadCond(&queue->jobAvailable, &queue->lock);
+
+        if (queue->count == 0) break;     // Exit requested and no jobs left
+
+        Job job = queue->jobs[queue->head];
+        queue->head = (queue->head + 1)%queue->capacity;
+        queue->count--;
+        queue->running++;
+
+        ReleaseThreadLock(&queue->lock);
+        job.func(job.data);
+        AcquireThreadLock(&queue->lock);
+
+        queue->running--;
+        if ((queue->count + queue->running) == 0) SignalThreadCond(&queue->jobsDone, true);
+    }
+
+    ReleaseThreadLock(&queue->lock);
+#else
+    (void)arg;
+#endif
+}
+
+// Parallel pool worker thread loop, helps current run until its jobs are all taken
+static void ParallelPoolWorker(void *arg)
+{
+#if defined(SUPPORT_THREADS)
+    (void)arg;
+
+    AcquireThreadLock(&parallelPool.lock);
+
+    while (true)
+    {
+        while (parallelPool.helpersWanted == 0) WaitThreadCond(&parallelPool.runAvailable, &parallelPool.lock);
+
+        ParallelRun *run = parallelPool.run;
+        parallelPool.helpersWanted--;
+        parallelPool.helpersActive++;
+
+        ReleaseThreadLock(&parallelPool.lock);
+        ParallelRunWorker(run);
+        AcquireThreadLock(&parallelPool.lock);
+
+        parallelPool.helpersActive--;
+        if (parallelPool.helpersActive == 0) SignalThreadCond(&parallelPool.runDone, true);
+    }
+#else
+    (void)arg;
+#endif
+}
+
+// Parallel run worker thread loop, runs jobs until no one left
+static void ParallelRunWorker(void *arg)
+{
+    ParallelRun *run = (ParallelRun *)arg;
+
+    while (true)
+    {
+        int job = 0;
+
+#if defined(SUPPORT_THREADS)
+        AcquireThreadLock(&run->lock);
+        job = run->nextJob++;
+        ReleaseThreadLock(&run->lock);
+#else
+        job = run->nextJob++;
+#endif
+        if (job >= run->jobCount) break;
+
+        run->func(run->jobs + (size_t)job*run->jobSize);
+    }
+}
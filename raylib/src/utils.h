@@ -55,6 +55,11 @@
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
+typedef struct Mutex Mutex;            // Mutex, opaque type
+typedef struct JobQueue JobQueue;      // Job queue processed by worker threads, opaque type
+
+typedef void (*JobFunc)(void *data);   // Job function, receives job data
+
 #ifdef __cplusplus
 extern "C" {            // Prevents name mangling of functions
 #endif
@@ -72,6 +77,21 @@ void InitAssetManager(AAssetManager *manager, const char *dataPath);   // Initia
 FILE *android_fopen(const char *fileName, const char *mode);            // Replacement for fopen() -> Read-only!
 #endif
 
+// Threading functions
+// NOTE: On platforms without threads support (PLATFORM_WEB) jobs run on the calling thread
+int GetCPUCount(void);                                                  // Get number of logical processors available
+Mutex *LoadMutex(void);                                                 // Load mutex
+void UnloadMutex(Mutex *mutex);                                         // Unload mutex
+void LockMutex(Mutex *mutex);                                           // Lock mutex, waits if locked by another thread
+void UnlockMutex(Mutex *mutex);                                         // Unlock mutex
+
+JobQueue *LoadJobQueue(int threadCount, int capacity);                  // Load job queue with worker threads and bounded capacity
+void UnloadJobQueue(JobQueue *queue);                                   // Unload job queue, waits for pending jobs
+bool PushJob(JobQueue *queue, JobFunc func, void *data);                // Push job into queue, returns false if queue is full (never blocks)
+int GetJobQueuePending(JobQueue *queue);                                // Get number of jobs queued or being processed
+void WaitJobQueue(JobQueue *queue);                                     // Wait until all queued jobs have been processed
+void RunJobsParallel(JobFunc func, void *jobs, int jobSize, int jobCount, int threadCount);  // Run jobs array in parallel, wait for completion
+
 #ifdef __cplusplus
 }
 #endif